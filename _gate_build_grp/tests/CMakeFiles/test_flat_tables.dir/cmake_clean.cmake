@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_flat_tables.dir/test_flat_tables.cpp.o"
+  "CMakeFiles/test_flat_tables.dir/test_flat_tables.cpp.o.d"
+  "test_flat_tables"
+  "test_flat_tables.pdb"
+  "test_flat_tables[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_flat_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unordered_map.dir/test_unordered_map.cpp.o"
+  "CMakeFiles/test_unordered_map.dir/test_unordered_map.cpp.o.d"
+  "test_unordered_map"
+  "test_unordered_map.pdb"
+  "test_unordered_map[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unordered_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+add_test([=[CompactFlatMapTest.HandleSize]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.HandleSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.HandleSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.InsertAndFind]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.InsertAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.LongProbes]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.LongProbes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.LongProbes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.LoadFactorIsStoredInTable]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.LoadFactorIsStoredInTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.LoadFactorIsStoredInTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.NestedCopyMoveAndSwap]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.NestedCopyMoveAndSwap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.NestedCopyMoveAndSwap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.PersistNested]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.PersistNested]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.PersistNested]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactFlatMapTest.ScopedAllocator]=]  /root/repo/_gate_build_grp/tests/test_compact_flat_map [==[--gtest_filter=CompactFlatMapTest.ScopedAllocator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactFlatMapTest.ScopedAllocator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_compact_flat_map_TESTS CompactFlatMapTest.HandleSize CompactFlatMapTest.InsertAndFind CompactFlatMapTest.LongProbes CompactFlatMapTest.LoadFactorIsStoredInTable CompactFlatMapTest.NestedCopyMoveAndSwap CompactFlatMapTest.PersistNested CompactFlatMapTest.ScopedAllocator)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_grp/tests/test_flat_tables[1]_tests.cmake")
+  include("/root/repo/_gate_build_grp/tests/test_flat_tables[1]_tests.cmake")
+else()
+  add_test(test_flat_tables_NOT_BUILT test_flat_tables_NOT_BUILT)
+endif()
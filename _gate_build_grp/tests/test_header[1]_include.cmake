@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_grp/tests/test_header[1]_tests.cmake")
+  include("/root/repo/_gate_build_grp/tests/test_header[1]_tests.cmake")
+else()
+  add_test(test_header_NOT_BUILT test_header_NOT_BUILT)
+endif()
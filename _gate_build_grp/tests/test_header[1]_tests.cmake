@@ -0,0 +1,11 @@
+add_test([=[HeaderTest.DefaultConstructor]=]  /root/repo/_gate_build_grp/tests/test_header [==[--gtest_filter=HeaderTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeaderTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeaderTest.MaxProbeDistance]=]  /root/repo/_gate_build_grp/tests/test_header [==[--gtest_filter=HeaderTest.MaxProbeDistance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeaderTest.MaxProbeDistance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeaderTest.ProbeDistance]=]  /root/repo/_gate_build_grp/tests/test_header [==[--gtest_filter=HeaderTest.ProbeDistance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeaderTest.ProbeDistance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeaderTest.Empty]=]  /root/repo/_gate_build_grp/tests/test_header [==[--gtest_filter=HeaderTest.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeaderTest.Empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HeaderTest.Clear]=]  /root/repo/_gate_build_grp/tests/test_header [==[--gtest_filter=HeaderTest.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HeaderTest.Clear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_header_TESTS HeaderTest.DefaultConstructor HeaderTest.MaxProbeDistance HeaderTest.ProbeDistance HeaderTest.Empty HeaderTest.Clear)
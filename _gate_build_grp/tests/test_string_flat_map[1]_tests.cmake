@@ -0,0 +1,15 @@
+add_test([=[StringFlatMapTest.InsertAndFind]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.InsertAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.NoAllocationForShortKeys]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.NoAllocationForShortKeys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.NoAllocationForShortKeys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.SharedPrefixes]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.SharedPrefixes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.SharedPrefixes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.RandomOperations]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.RandomOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.CopyMoveAndSwap]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.CopyMoveAndSwap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.CopyMoveAndSwap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.StringHash]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.StringHash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.StringHash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringFlatMapTest.Persist]=]  /root/repo/_gate_build_grp/tests/test_string_flat_map [==[--gtest_filter=StringFlatMapTest.Persist]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringFlatMapTest.Persist]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_string_flat_map_TESTS StringFlatMapTest.InsertAndFind StringFlatMapTest.NoAllocationForShortKeys StringFlatMapTest.SharedPrefixes StringFlatMapTest.RandomOperations StringFlatMapTest.CopyMoveAndSwap StringFlatMapTest.StringHash StringFlatMapTest.Persist)
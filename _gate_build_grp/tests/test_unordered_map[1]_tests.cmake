@@ -0,0 +1,85 @@
+add_test([=[UnorderedMap.CopyConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.CopyConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.CopyConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.MoveConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.MoveConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Insert<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Insert<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.InsertAndFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.InsertAndFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Emplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Emplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Emplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.TryEmplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.TryEmplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.TryEmplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Count<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Count<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Erase<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Erase<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Clear<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Clear<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Iterator<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Iterator<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.ReserveAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.ReserveAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.ReserveAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.ReserveAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.ReserveAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.ReserveAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.RehashAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.RehashAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.RehashAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.RehashAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.RehashAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.RehashAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.EraseUsingIteratorFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.EraseUsingIteratorBegin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.LoadFactor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.LoadFactor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.LoadFactor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Swap<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Swap<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Equality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Equality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Inequality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/0.Inequality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Inequality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.CopyConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.CopyConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.CopyConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.MoveConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.MoveConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Insert<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Insert<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.InsertAndFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.InsertAndFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Emplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Emplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Emplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.TryEmplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.TryEmplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.TryEmplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Count<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Count<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Erase<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Erase<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Clear<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Clear<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Iterator<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Iterator<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.ReserveAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.ReserveAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.ReserveAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.ReserveAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.ReserveAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.ReserveAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.RehashAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.RehashAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.RehashAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.RehashAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.RehashAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.RehashAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.EraseUsingIteratorFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.EraseUsingIteratorBegin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.LoadFactor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.LoadFactor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.LoadFactor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Swap<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Swap<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Equality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Equality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMap.Inequality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMap/1.Inequality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMap.Inequality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMapCustomHash.Insert<perroht::unordered_flat_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMapCustomHash/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMapCustomHash.Insert<perroht::unordered_flat_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedMapCustomHash.Insert<perroht::unordered_node_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_grp/tests/test_unordered_map [==[--gtest_filter=UnorderedMapCustomHash/1.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedMapCustomHash.Insert<perroht::unordered_node_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_grp/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_unordered_map_TESTS [==[UnorderedMap.CopyConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.MoveConstructor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Insert<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.InsertAndFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Emplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.TryEmplace<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Count<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Erase<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Clear<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Iterator<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.ReserveAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.ReserveAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.RehashAfterEmpty<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.RehashAfterinsertion<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.LoadFactor<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Swap<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Equality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Inequality<perroht::unordered_flat_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.CopyConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.MoveConstructor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Insert<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.InsertAndFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Emplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.TryEmplace<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Count<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Erase<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Clear<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Iterator<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.ReserveAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.ReserveAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.RehashAfterEmpty<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.RehashAfterinsertion<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.EraseUsingIteratorFind<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.EraseUsingIteratorBegin<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.LoadFactor<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Swap<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Equality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMap.Inequality<perroht::unordered_node_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMapCustomHash.Insert<perroht::unordered_flat_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==] [==[UnorderedMapCustomHash.Insert<perroht::unordered_node_map<int, int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::GroupedHeaderLayout>>]==])
@@ -0,0 +1,2 @@
+#define PERROHT_VERSION_MAJOR 0
+#define PERROHT_VERSION_MINOR 1
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_data_holder.dir/test_data_holder.cpp.o"
+  "CMakeFiles/test_data_holder.dir/test_data_holder.cpp.o.d"
+  "test_data_holder"
+  "test_data_holder.pdb"
+  "test_data_holder[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_data_holder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
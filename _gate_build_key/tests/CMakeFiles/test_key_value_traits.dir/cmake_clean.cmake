@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_key_value_traits.dir/test_key_value_traits.cpp.o"
+  "CMakeFiles/test_key_value_traits.dir/test_key_value_traits.cpp.o.d"
+  "test_key_value_traits"
+  "test_key_value_traits.pdb"
+  "test_key_value_traits[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_key_value_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
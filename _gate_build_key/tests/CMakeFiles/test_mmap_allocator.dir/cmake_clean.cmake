@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mmap_allocator.dir/test_mmap_allocator.cpp.o"
+  "CMakeFiles/test_mmap_allocator.dir/test_mmap_allocator.cpp.o.d"
+  "test_mmap_allocator"
+  "test_mmap_allocator.pdb"
+  "test_mmap_allocator[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mmap_allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unordered_set.dir/test_unordered_set.cpp.o"
+  "CMakeFiles/test_unordered_set.dir/test_unordered_set.cpp.o.d"
+  "test_unordered_set"
+  "test_unordered_set.pdb"
+  "test_unordered_set[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unordered_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_build_key/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_build_key/tests/test_key_value_traits[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_data_holder[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_header[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_perroht[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_unordered_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_unordered_set[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_mmap_allocator[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_dense_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_int_flat_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_small_flat_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_compact_flat_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_string_flat_map[1]_include.cmake")
+include("/root/repo/_gate_build_key/tests/test_flat_tables[1]_include.cmake")
+subdirs("../_deps/googletest-build")
@@ -0,0 +1,13 @@
+add_test([=[DenseMapTest.InsertAndFind]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.InsertAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseMapTest.ElementsArePacked]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.ElementsArePacked]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.ElementsArePacked]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseMapTest.EraseWhileIterating]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.EraseWhileIterating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.EraseWhileIterating]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseMapTest.RandomOperations]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.RandomOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseMapTest.CopyAndEquality]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.CopyAndEquality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.CopyAndEquality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseMapTest.ThrowingConstructorLeavesNoEntry]=]  /root/repo/_gate_build_key/tests/test_dense_map [==[--gtest_filter=DenseMapTest.ThrowingConstructorLeavesNoEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DenseMapTest.ThrowingConstructorLeavesNoEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_dense_map_TESTS DenseMapTest.InsertAndFind DenseMapTest.ElementsArePacked DenseMapTest.EraseWhileIterating DenseMapTest.RandomOperations DenseMapTest.CopyAndEquality DenseMapTest.ThrowingConstructorLeavesNoEntry)
@@ -0,0 +1,11 @@
+add_test([=[IntFlatMapTest.InsertAndFind]=]  /root/repo/_gate_build_key/tests/test_int_flat_map [==[--gtest_filter=IntFlatMapTest.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntFlatMapTest.InsertAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntFlatMapTest.EmptyKeyIsKeptAside]=]  /root/repo/_gate_build_key/tests/test_int_flat_map [==[--gtest_filter=IntFlatMapTest.EmptyKeyIsKeptAside]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntFlatMapTest.EmptyKeyIsKeptAside]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntFlatMapTest.RehashCopyAndEquality]=]  /root/repo/_gate_build_key/tests/test_int_flat_map [==[--gtest_filter=IntFlatMapTest.RehashCopyAndEquality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntFlatMapTest.RehashCopyAndEquality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntFlatMapTest.Persist]=]  /root/repo/_gate_build_key/tests/test_int_flat_map [==[--gtest_filter=IntFlatMapTest.Persist]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntFlatMapTest.Persist]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntFlatSetTest.InsertEraseAndFind]=]  /root/repo/_gate_build_key/tests/test_int_flat_map [==[--gtest_filter=IntFlatSetTest.InsertEraseAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntFlatSetTest.InsertEraseAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_int_flat_map_TESTS IntFlatMapTest.InsertAndFind IntFlatMapTest.EmptyKeyIsKeptAside IntFlatMapTest.RehashCopyAndEquality IntFlatMapTest.Persist IntFlatSetTest.InsertEraseAndFind)
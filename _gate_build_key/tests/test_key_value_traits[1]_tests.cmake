@@ -0,0 +1,9 @@
+add_test([=[KeyValueTraitsTest.KeyValueEmbed]=]  /root/repo/_gate_build_key/tests/test_key_value_traits [==[--gtest_filter=KeyValueTraitsTest.KeyValueEmbed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyValueTraitsTest.KeyValueEmbed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyValueTraitsTest.KeyValueNode]=]  /root/repo/_gate_build_key/tests/test_key_value_traits [==[--gtest_filter=KeyValueTraitsTest.KeyValueNode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyValueTraitsTest.KeyValueNode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyValueTraitsTest.KeyNoValueEmbed]=]  /root/repo/_gate_build_key/tests/test_key_value_traits [==[--gtest_filter=KeyValueTraitsTest.KeyNoValueEmbed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyValueTraitsTest.KeyNoValueEmbed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KeyValueTraitsTest.KeyNoValueNode]=]  /root/repo/_gate_build_key/tests/test_key_value_traits [==[--gtest_filter=KeyValueTraitsTest.KeyNoValueNode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[KeyValueTraitsTest.KeyNoValueNode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_key_value_traits_TESTS KeyValueTraitsTest.KeyValueEmbed KeyValueTraitsTest.KeyValueNode KeyValueTraitsTest.KeyNoValueEmbed KeyValueTraitsTest.KeyNoValueNode)
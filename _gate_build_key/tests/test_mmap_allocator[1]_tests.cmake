@@ -0,0 +1,35 @@
+add_test([=[MmapAllocatorTest.AllocateAndDeallocate]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.AllocateAndDeallocate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.AllocateAndDeallocate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.NamedObjects]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.NamedObjects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.NamedObjects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.PersistFlatMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.PersistFlatMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.PersistFlatMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.PersistNodeMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.PersistNodeMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.PersistNodeMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.MoveBetweenSegments]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.MoveBetweenSegments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.MoveBetweenSegments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.MigrateFlatMapFromDram]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.MigrateFlatMapFromDram]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.MigrateFlatMapFromDram]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.MigrateNodeMapFromDram]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.MigrateNodeMapFromDram]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.MigrateNodeMapFromDram]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.MigrateBetweenSegments]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.MigrateBetweenSegments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.MigrateBetweenSegments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.InPlaceResizeFlatMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.InPlaceResizeFlatMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.InPlaceResizeFlatMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.InPlaceResizeNodeMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.InPlaceResizeNodeMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.InPlaceResizeNodeMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.InPlaceResizePeakMemory]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.InPlaceResizePeakMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.InPlaceResizePeakMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.InPlaceResizeRequiresAllocatorSupport]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.InPlaceResizeRequiresAllocatorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.InPlaceResizeRequiresAllocatorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.WarmUpFlatMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.WarmUpFlatMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.WarmUpFlatMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.WarmUpNodeMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.WarmUpNodeMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.WarmUpNodeMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.WarmUpEmptyMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.WarmUpEmptyMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.WarmUpEmptyMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.RecoverInterruptedBatch]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.RecoverInterruptedBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.RecoverInterruptedBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MmapAllocatorTest.ScopedAllocatorNestedMap]=]  /root/repo/_gate_build_key/tests/test_mmap_allocator [==[--gtest_filter=MmapAllocatorTest.ScopedAllocatorNestedMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MmapAllocatorTest.ScopedAllocatorNestedMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_mmap_allocator_TESTS MmapAllocatorTest.AllocateAndDeallocate MmapAllocatorTest.NamedObjects MmapAllocatorTest.PersistFlatMap MmapAllocatorTest.PersistNodeMap MmapAllocatorTest.MoveBetweenSegments MmapAllocatorTest.MigrateFlatMapFromDram MmapAllocatorTest.MigrateNodeMapFromDram MmapAllocatorTest.MigrateBetweenSegments MmapAllocatorTest.InPlaceResizeFlatMap MmapAllocatorTest.InPlaceResizeNodeMap MmapAllocatorTest.InPlaceResizePeakMemory MmapAllocatorTest.InPlaceResizeRequiresAllocatorSupport MmapAllocatorTest.WarmUpFlatMap MmapAllocatorTest.WarmUpNodeMap MmapAllocatorTest.WarmUpEmptyMap MmapAllocatorTest.RecoverInterruptedBatch MmapAllocatorTest.ScopedAllocatorNestedMap)
@@ -0,0 +1,11 @@
+add_test([=[SmallFlatMapTest.InsertAndFind]=]  /root/repo/_gate_build_key/tests/test_small_flat_map [==[--gtest_filter=SmallFlatMapTest.InsertAndFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFlatMapTest.InsertAndFind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFlatMapTest.NoAllocationWhileInline]=]  /root/repo/_gate_build_key/tests/test_small_flat_map [==[--gtest_filter=SmallFlatMapTest.NoAllocationWhileInline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFlatMapTest.NoAllocationWhileInline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFlatMapTest.RandomOperations]=]  /root/repo/_gate_build_key/tests/test_small_flat_map [==[--gtest_filter=SmallFlatMapTest.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFlatMapTest.RandomOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFlatMapTest.EraseWhileIterating]=]  /root/repo/_gate_build_key/tests/test_small_flat_map [==[--gtest_filter=SmallFlatMapTest.EraseWhileIterating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFlatMapTest.EraseWhileIterating]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallFlatMapTest.CopyMoveAndSwap]=]  /root/repo/_gate_build_key/tests/test_small_flat_map [==[--gtest_filter=SmallFlatMapTest.CopyMoveAndSwap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SmallFlatMapTest.CopyMoveAndSwap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_small_flat_map_TESTS SmallFlatMapTest.InsertAndFind SmallFlatMapTest.NoAllocationWhileInline SmallFlatMapTest.RandomOperations SmallFlatMapTest.EraseWhileIterating SmallFlatMapTest.CopyMoveAndSwap)
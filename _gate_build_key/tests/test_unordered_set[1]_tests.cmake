@@ -0,0 +1,77 @@
+add_test([=[UnorderedSet.CopyConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.CopyConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.CopyConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.MoveConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.MoveConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Insert<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Insert<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Emplace<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Emplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Emplace<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Count<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Count<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Erase<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Erase<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Clear<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Clear<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Iterator<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Iterator<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.ReserveAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.ReserveAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.ReserveAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.reserveAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.reserveAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.reserveAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.RehashAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.RehashAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.RehashAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.RehashAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.RehashAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.RehashAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.EraseUsingIteratorFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.EraseUsingIteratorBegin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.LoadFactor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.LoadFactor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.LoadFactor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Swap<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Swap<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Equality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Equality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Inequality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/0.Inequality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Inequality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.CopyConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.CopyConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.CopyConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.MoveConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.MoveConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Insert<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Insert<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Emplace<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Emplace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Emplace<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Count<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Count<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Erase<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Erase<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Clear<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Clear<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Iterator<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Iterator<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.ReserveAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.ReserveAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.ReserveAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.reserveAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.reserveAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.reserveAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.RehashAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.RehashAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.RehashAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.RehashAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.RehashAfterinsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.RehashAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.EraseUsingIteratorFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.EraseUsingIteratorBegin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.LoadFactor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.LoadFactor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.LoadFactor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Swap<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Swap<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Equality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Equality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSet.Inequality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSet/1.Inequality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSet.Inequality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSetCustomHash.Insert<perroht::unordered_flat_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSetCustomHash/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSetCustomHash.Insert<perroht::unordered_flat_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnorderedSetCustomHash.Insert<perroht::unordered_node_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_key/tests/test_unordered_set [==[--gtest_filter=UnorderedSetCustomHash/1.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UnorderedSetCustomHash.Insert<perroht::unordered_node_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_key/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_unordered_set_TESTS [==[UnorderedSet.CopyConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.MoveConstructor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Insert<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Emplace<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Count<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Erase<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Clear<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Iterator<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.ReserveAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.reserveAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.RehashAfterEmpty<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.RehashAfterinsertion<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.LoadFactor<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Swap<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Equality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Inequality<perroht::unordered_flat_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.CopyConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.MoveConstructor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Insert<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Emplace<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Count<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Erase<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Clear<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Iterator<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.ReserveAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.reserveAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.RehashAfterEmpty<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.RehashAfterinsertion<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.EraseUsingIteratorFind<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.EraseUsingIteratorBegin<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.LoadFactor<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Swap<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Equality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSet.Inequality<perroht::unordered_node_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSetCustomHash.Insert<perroht::unordered_flat_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==] [==[UnorderedSetCustomHash.Insert<perroht::unordered_node_set<int, CustomHash, std::equal_to<int>, std::allocator<int>, perroht::SeparateKeyLayout>>]==])
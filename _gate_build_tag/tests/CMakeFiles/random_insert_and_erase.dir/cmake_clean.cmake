@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_insert_and_erase.dir/random_insert_and_erase.cpp.o"
+  "CMakeFiles/random_insert_and_erase.dir/random_insert_and_erase.cpp.o.d"
+  "random_insert_and_erase"
+  "random_insert_and_erase.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_insert_and_erase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
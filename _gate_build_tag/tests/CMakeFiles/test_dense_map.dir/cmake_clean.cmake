@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dense_map.dir/test_dense_map.cpp.o"
+  "CMakeFiles/test_dense_map.dir/test_dense_map.cpp.o.d"
+  "test_dense_map"
+  "test_dense_map.pdb"
+  "test_dense_map[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dense_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
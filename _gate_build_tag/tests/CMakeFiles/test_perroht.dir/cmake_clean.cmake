@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_perroht.dir/test_perroht.cpp.o"
+  "CMakeFiles/test_perroht.dir/test_perroht.cpp.o.d"
+  "test_perroht"
+  "test_perroht.pdb"
+  "test_perroht[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_perroht.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+add_test([=[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/0.DefaultConstructInPlaceor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/0.ConstructInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/0.MoveConstruct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/0.MoveAssign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/0.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/1.DefaultConstructInPlaceor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/1.ConstructInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/1.MoveConstruct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/1.MoveAssign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_KeyValue/1.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/0.DefaultConstructInPlaceor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/0.ConstructInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/0.MoveConstruct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/0.MoveAssign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/0.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/1.DefaultConstructInPlaceor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/1.ConstructInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/1.MoveConstruct]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/1.MoveAssign]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest_Key/1.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest.DefaultConstructInPlaceor]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest.DefaultConstructInPlaceor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest.DefaultConstructInPlaceor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest.Size]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest.Size]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest.Size]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DataHolderTest.TaggedNode]=]  /root/repo/_gate_build_tag/tests/test_data_holder [==[--gtest_filter=DataHolderTest.TaggedNode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DataHolderTest.TaggedNode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_data_holder_TESTS [==[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, true, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.ConstructInPlace<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.MoveConstruct<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.MoveAssign<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]==] [==[DataHolderTest_KeyValue.Swap<perroht::prhdtls::DataHolder<int, false, std::allocator<int>, false>>]==] [==[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, true, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.DefaultConstructInPlaceor<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.ConstructInPlace<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.MoveConstruct<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.MoveAssign<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] [==[DataHolderTest_Key.Swap<perroht::prhdtls::DataHolder<std::vector<int, std::allocator<int> >, false, std::allocator<std::vector<int, std::allocator<int> > >, false>>]==] DataHolderTest.DefaultConstructInPlaceor DataHolderTest.Size DataHolderTest.TaggedNode)
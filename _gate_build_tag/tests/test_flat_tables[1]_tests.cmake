@@ -0,0 +1,13 @@
+add_test([=[FlatTablesTest.RandomOperations<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/0.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.RandomOperations<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/0.EraseWhileIterating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatTablesTest.RandomOperations<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/1.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.RandomOperations<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/1.EraseWhileIterating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatTablesTest.RandomOperations<StringKeys>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/2.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.RandomOperations<StringKeys>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FlatTablesTest.EraseWhileIterating<StringKeys>]=]  /root/repo/_gate_build_tag/tests/test_flat_tables [==[--gtest_filter=FlatTablesTest/2.EraseWhileIterating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FlatTablesTest.EraseWhileIterating<StringKeys>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_flat_tables_TESTS [==[FlatTablesTest.RandomOperations<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]==] [==[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::int_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]==] [==[FlatTablesTest.RandomOperations<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]==] [==[FlatTablesTest.EraseWhileIterating<IntegerKeys<perroht::compact_flat_map<unsigned long, unsigned long, std::hash<unsigned long>, std::equal_to<unsigned long>, std::allocator<std::pair<unsigned long, unsigned long> > >, unsigned long>>]==] [==[FlatTablesTest.RandomOperations<StringKeys>]==] [==[FlatTablesTest.EraseWhileIterating<StringKeys>]==])
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_tag/tests/test_mmap_allocator[1]_tests.cmake")
+  include("/root/repo/_gate_build_tag/tests/test_mmap_allocator[1]_tests.cmake")
+else()
+  add_test(test_mmap_allocator_NOT_BUILT test_mmap_allocator_NOT_BUILT)
+endif()
@@ -0,0 +1,127 @@
+add_test([=[PerrohtUniqueTest_KeyValue.DefaultConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.DefaultConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.CopyConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.CopyConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.CopyConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.MoveConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.MoveConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.CopyLargeTable<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.CopyLargeTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.CopyLargeTable<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Empty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Empty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Empty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Insert<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Insert<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Find<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Find]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Find<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.FindExpectedEnd<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.FindExpectedEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.FindExpectedEnd<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Count<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Count]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Count<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Clear<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Clear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Clear<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Iterator<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Iterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Iterator<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.ReserveAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.ReserveAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.ReserveAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.ReserveAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.ReserveAfterInsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.ReserveAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.RehashAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.RehashAfterEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.RehashAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.RehashAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.RehashAfterInsertion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.RehashAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.ShrinkToFit<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.ShrinkToFit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.ShrinkToFit<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Erase<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Erase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Erase<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.EraseUsingIteratorFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.EraseUsingIteratorFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.EraseUsingIteratorFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.EraseUsingIteratorBegin<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.EraseUsingIteratorBegin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.EraseUsingIteratorBegin<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.IterateFromFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.IterateFromFind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.IterateFromFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.EraseWhileIteratingVisitsOnce<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.EraseWhileIteratingVisitsOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.EraseWhileIteratingVisitsOnce<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.IteratorConversion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.IteratorConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.IteratorConversion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.LoadFactor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.LoadFactor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.LoadFactor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Swap<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Swap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Swap<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Equality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Equality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Inequality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Inequality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Inequality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.CheckIntegrity<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.CheckIntegrity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.CheckIntegrity<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Recover<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Recover]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Recover<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.DirtyPages<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.DirtyPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.DirtyPages<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.ApplyBatch<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.ApplyBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.ApplyBatch<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Transaction<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Transaction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Transaction<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.Snapshot<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.Snapshot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.Snapshot<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue.ChangeLog<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue/0.ChangeLog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue.ChangeLog<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue_CustomHash.Insert<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue_CustomHash/0.Insert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue_CustomHash.Insert<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue_CustomHash.Resize<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue_CustomHash/0.Resize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue_CustomHash.Resize<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue_CustomHash.EqualityWithDifferentLayouts<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue_CustomHash/0.EqualityWithDifferentLayouts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue_CustomHash.EqualityWithDifferentLayouts<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtUniqueTest_KeyValue_CustomHash.View<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtUniqueTest_KeyValue_CustomHash/0.View]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtUniqueTest_KeyValue_CustomHash.View<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::InterleavedLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtLayoutTest/0.ResizeAndErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::InterleavedLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateHeaderLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtLayoutTest/1.ResizeAndErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateKeyLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtLayoutTest/2.ResizeAndErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateKeyLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::GroupedHeaderLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtLayoutTest/3.ResizeAndErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::GroupedHeaderLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtLayoutTest/4.ResizeAndErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtTaggedNodeTest.StringKeys]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtTaggedNodeTest.StringKeys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtTaggedNodeTest.StringKeys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtTryEmplaceTest.ForwardsArguments]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtTryEmplaceTest.ForwardsArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtTryEmplaceTest.ForwardsArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtTryEmplaceTest.ThrowingConstructorLeavesNoEntry]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtTryEmplaceTest.ThrowingConstructorLeavesNoEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtTryEmplaceTest.ThrowingConstructorLeavesNoEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtRelocationTest.RelocatableValues]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtRelocationTest.RelocatableValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtRelocationTest.RelocatableValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtInsertionTest.DisplacedEntriesAreMovedOnce]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtInsertionTest.DisplacedEntriesAreMovedOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtInsertionTest.DisplacedEntriesAreMovedOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtInsertionTest.LongRuns]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtInsertionTest.LongRuns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtInsertionTest.LongRuns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtIteratorTest.EraseShiftingWrappedEntryVisitsOnce]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtIteratorTest.EraseShiftingWrappedEntryVisitsOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtIteratorTest.EraseShiftingWrappedEntryVisitsOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtStashTest.StashesFarElements]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtStashTest.StashesFarElements]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtStashTest.StashesFarElements]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtStashTest.StashesAfterBatch]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtStashTest.StashesAfterBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtStashTest.StashesAfterBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtStashTest.EvictsPushedElements]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtStashTest.EvictsPushedElements]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtStashTest.EvictsPushedElements]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtStashTest.MeanProbeDistanceExcludesStash]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtStashTest.MeanProbeDistanceExcludesStash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtStashTest.MeanProbeDistanceExcludesStash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtStashTest.RandomOperations]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtStashTest.RandomOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtStashTest.RandomOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtSideStateTest.SettingsMoveWithTheTable]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtSideStateTest.SettingsMoveWithTheTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtSideStateTest.SettingsMoveWithTheTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtSideStateTest.SyncFlushesHandleAndStash]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtSideStateTest.SyncFlushesHandleAndStash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtSideStateTest.SyncFlushesHandleAndStash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtNodeTest.ResizeAndCheckIntegrity]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtNodeTest.ResizeAndCheckIntegrity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtNodeTest.ResizeAndCheckIntegrity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtNodeTest.DirtyPages]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtNodeTest.DirtyPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtNodeTest.DirtyPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtNodeTest.Transaction]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtNodeTest.Transaction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtNodeTest.Transaction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtSeparateKeyTest.WideValues]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtSeparateKeyTest.WideValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtSeparateKeyTest.WideValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtSeparateKeyTest.StringKeys]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtSeparateKeyTest.StringKeys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtSeparateKeyTest.StringKeys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtEmbeddedTest.MoveResizeAndRecover]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtEmbeddedTest.MoveResizeAndRecover]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtEmbeddedTest.MoveResizeAndRecover]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PerrohtSnapshotTest.ConcurrentReader]=]  /root/repo/_gate_build_tag/tests/test_perroht [==[--gtest_filter=PerrohtSnapshotTest.ConcurrentReader]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerrohtSnapshotTest.ConcurrentReader]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_tag/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_perroht_TESTS [==[PerrohtUniqueTest_KeyValue.DefaultConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.CopyConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.MoveConstructor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.CopyLargeTable<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Empty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Insert<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Find<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.FindExpectedEnd<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Count<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Clear<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Iterator<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.ReserveAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.ReserveAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.RehashAfterEmpty<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.RehashAfterInsertion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.ShrinkToFit<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Erase<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.EraseUsingIteratorFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.EraseUsingIteratorBegin<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.IterateFromFind<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.EraseWhileIteratingVisitsOnce<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.IteratorConversion<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.LoadFactor<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Swap<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Equality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Inequality<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.CheckIntegrity<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Recover<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.DirtyPages<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.ApplyBatch<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Transaction<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.Snapshot<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue.ChangeLog<perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue_CustomHash.Insert<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue_CustomHash.Resize<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue_CustomHash.EqualityWithDifferentLayouts<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtUniqueTest_KeyValue_CustomHash.View<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] [==[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::InterleavedLayout>>]==] [==[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateHeaderLayout>>]==] [==[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::SeparateKeyLayout>>]==] [==[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::GroupedHeaderLayout>>]==] [==[PerrohtLayoutTest.ResizeAndErase<perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true, std::allocator<std::pair<int, int> >, perroht::TaggedNodeLayout>>]==] PerrohtTaggedNodeTest.StringKeys PerrohtTryEmplaceTest.ForwardsArguments PerrohtTryEmplaceTest.ThrowingConstructorLeavesNoEntry PerrohtRelocationTest.RelocatableValues PerrohtInsertionTest.DisplacedEntriesAreMovedOnce PerrohtInsertionTest.LongRuns PerrohtIteratorTest.EraseShiftingWrappedEntryVisitsOnce PerrohtStashTest.StashesFarElements PerrohtStashTest.StashesAfterBatch PerrohtStashTest.EvictsPushedElements PerrohtStashTest.MeanProbeDistanceExcludesStash PerrohtStashTest.RandomOperations PerrohtSideStateTest.SettingsMoveWithTheTable PerrohtSideStateTest.SyncFlushesHandleAndStash PerrohtNodeTest.ResizeAndCheckIntegrity PerrohtNodeTest.DirtyPages PerrohtNodeTest.Transaction PerrohtSeparateKeyTest.WideValues PerrohtSeparateKeyTest.StringKeys PerrohtEmbeddedTest.MoveResizeAndRecover PerrohtSnapshotTest.ConcurrentReader)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_tag/tests/test_small_flat_map[1]_tests.cmake")
+  include("/root/repo/_gate_build_tag/tests/test_small_flat_map[1]_tests.cmake")
+else()
+  add_test(test_small_flat_map_NOT_BUILT test_small_flat_map_NOT_BUILT)
+endif()
@@ -15,15 +15,29 @@
 #include <perroht/utilities/time.hpp>
 #include <perroht/utilities/hash.hpp>
 
-template <typename Key, typename MappedValue>
-using PerrohtMap =
-    perroht::unordered_flat_map<Key, MappedValue, perroht::Hash<Key>,
-                                std::equal_to<Key>>;
+template <typename Key, typename MappedValue,
+          typename Layout = perroht::DefaultLayout>
+using PerrohtMap = perroht::unordered_flat_map<
+    Key, MappedValue, perroht::Hash<Key>, std::equal_to<Key>,
+    std::allocator<std::pair<Key, MappedValue>>, Layout>;
 
-template <typename Key, typename MappedValue>
+template <typename Key, typename MappedValue,
+          typename Layout = perroht::DefaultLayout>
 using PerrohtMapMetall = perroht::unordered_flat_map<
     Key, MappedValue, perroht::Hash<Key>, std::equal_to<Key>,
-    metall::manager::allocator_type<std::pair<const Key, MappedValue>>>;
+    metall::manager::allocator_type<std::pair<const Key, MappedValue>>,
+    Layout>;
+
+/// Calls 'func' with an object of each Perroht table layout type
+/// and the suffix that names the layout in the results,
+/// so that the layouts are benchmarked side by side.
+template <typename FuncT>
+inline void ForEachPerrohtLayout(FuncT&& func) {
+  func(perroht::InterleavedLayout{}, "");
+  func(perroht::SeparateHeaderLayout{}, "-SeparateHeader");
+  func(perroht::SeparateKeyLayout{}, "-SeparateKey");
+  func(perroht::GroupedHeaderLayout{}, "-GroupedHeader");
+}
 
 struct Stats {
   double min;
@@ -73,13 +73,16 @@ void RunBench(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Erase-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        PerrohtMap<DataType, DataType> map;
-        return EraseItems(file_path, batch_size, map);
-      },
-      true, "Erase-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          PerrohtMap<DataType, DataType, Layout> map;
+          return EraseItems(file_path, batch_size, map);
+        },
+        true, "Erase-Perroht" + layout_name);
+  });
 }
 
 template <typename DataType>
@@ -97,15 +100,20 @@ void RunBenchMetall(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Erase-Metall-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        metall::manager manager(metall::create_only, data_store_path.c_str());
-        auto* map = manager.construct<PerrohtMapMetall<DataType, DataType>>(
-            "map")(manager.get_allocator());
-        return EraseItems(file_path, batch_size, *map);
-      },
-      true, "Erase-Metall-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          metall::manager manager(metall::create_only,
+                                  data_store_path.c_str());
+          auto* map =
+              manager.construct<PerrohtMapMetall<DataType, DataType, Layout>>(
+                  "map")(manager.get_allocator());
+          return EraseItems(file_path, batch_size, *map);
+        },
+        true, "Erase-Metall-Perroht" + layout_name);
+  });
 }
 
 // parse CLI arguments using getopt
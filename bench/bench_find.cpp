@@ -96,13 +96,16 @@ void RunBench(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Find-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        PerrohtMap<DataType, DataType> map;
-        return FindItems(insert_file_path, find_file_path, batch_size, map);
-      },
-      true, "Find-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          PerrohtMap<DataType, DataType, Layout> map;
+          return FindItems(insert_file_path, find_file_path, batch_size, map);
+        },
+        true, "Find-Perroht" + layout_name);
+  });
 }
 
 template <typename DataType>
@@ -121,15 +124,20 @@ void RunBenchMetall(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Find-Metall-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        metall::manager manager(metall::create_only, data_store_path.c_str());
-        auto* map = manager.construct<PerrohtMapMetall<DataType, DataType>>(
-            "map")(manager.get_allocator());
-        return FindItems(insert_file_path, find_file_path, batch_size, *map);
-      },
-      true, "Find-Metall-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          metall::manager manager(metall::create_only,
+                                  data_store_path.c_str());
+          auto* map =
+              manager.construct<PerrohtMapMetall<DataType, DataType, Layout>>(
+                  "map")(manager.get_allocator());
+          return FindItems(insert_file_path, find_file_path, batch_size, *map);
+        },
+        true, "Find-Metall-Perroht" + layout_name);
+  });
 }
 
 // parse CLI arguments using getopt
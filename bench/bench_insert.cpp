@@ -70,13 +70,16 @@ void RunBench(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Insert-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        PerrohtMap<DataType, DataType> map;
-        return InsertItems(input_file_path, batch_size, map);
-      },
-      true, "Insert-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          PerrohtMap<DataType, DataType, Layout> map;
+          return InsertItems(input_file_path, batch_size, map);
+        },
+        true, "Insert-Perroht" + layout_name);
+  });
 }
 
 template <typename DataType>
@@ -94,15 +97,20 @@ void RunBenchMetall(const std::size_t num_repeats, const std::size_t batch_size,
       },
       true, "Insert-Metall-STL");
 
-  RunBenchmark(
-      num_repeats,
-      [&]() {
-        metall::manager manager(metall::create_only, data_store_path.c_str());
-        auto* map = manager.construct<PerrohtMapMetall<DataType, DataType>>(
-            "map")(manager.get_allocator());
-        return InsertItems(input_file_path, batch_size, *map);
-      },
-      true, "Insert-Metall-Perroht");
+  ForEachPerrohtLayout([&](auto layout, const std::string& layout_name) {
+    using Layout = decltype(layout);
+    RunBenchmark(
+        num_repeats,
+        [&]() {
+          metall::manager manager(metall::create_only,
+                                  data_store_path.c_str());
+          auto* map =
+              manager.construct<PerrohtMapMetall<DataType, DataType, Layout>>(
+                  "map")(manager.get_allocator());
+          return InsertItems(input_file_path, batch_size, *map);
+        },
+        true, "Insert-Metall-Perroht" + layout_name);
+  });
 }
 
 // parse CLI arguments using getopt
@@ -0,0 +1,188 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "details/compact_table.hpp"
+
+namespace perroht {
+
+/// \brief A flat map whose container object is a 16-byte handle (a table
+/// pointer and the size) when the hasher, key equal, and allocator are
+/// stateless. The capacity and the max load factor are stored in the table
+/// allocation. Intended for maps nested in other containers, including
+/// containers in persistent memory.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class compact_flat_map {
+ private:
+  using ImplType = prhdtls::CompactTable<Key, T, Hash, KeyEqual, Allocator>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = typename ImplType::KeyValueType;
+  using size_type = typename ImplType::SizeType;
+  using difference_type = typename ImplType::DifferentType;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename ImplType::Iterator;
+  using const_iterator = typename ImplType::ConstIterator;
+
+  compact_flat_map() : impl_() {}
+
+  explicit compact_flat_map(size_type n, const Hash& hash = Hash(),
+                            const key_equal& equal = key_equal(),
+                            const allocator_type& alloc = allocator_type())
+      : impl_(n, ImplType::kDefaultMaxLoadFactor, hash, equal, alloc) {}
+
+  explicit compact_flat_map(const allocator_type& alloc)
+      : impl_(0, ImplType::kDefaultMaxLoadFactor, Hash(), key_equal(), alloc) {}
+
+  compact_flat_map(const compact_flat_map& other) = default;
+  compact_flat_map(compact_flat_map&& other) noexcept = default;
+
+  compact_flat_map(const compact_flat_map& other, const allocator_type& alloc)
+      : impl_(other.impl_, alloc) {}
+
+  compact_flat_map(compact_flat_map&& other, const allocator_type& alloc)
+      : impl_(std::move(other.impl_), alloc) {}
+
+  ~compact_flat_map() = default;
+
+  compact_flat_map& operator=(const compact_flat_map& other) = default;
+  compact_flat_map& operator=(compact_flat_map&& other) noexcept = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(impl_.GetAllocator());
+  }
+
+  // ----- Iterators ----- //
+
+  iterator begin() noexcept { return impl_.Begin(); }
+
+  const_iterator begin() const noexcept { return impl_.Begin(); }
+
+  const_iterator cbegin() const noexcept { return impl_.Begin(); }
+
+  iterator end() noexcept { return impl_.End(); }
+
+  const_iterator end() const noexcept { return impl_.End(); }
+
+  const_iterator cend() const noexcept { return impl_.End(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return impl_.Empty(); }
+
+  size_type size() const noexcept { return impl_.Size(); }
+
+  size_type max_size() const noexcept { return impl_.MaxSize(); }
+
+  // ----- Modifiers ----- //
+
+  void clear() noexcept { impl_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return impl_.Insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return impl_.Insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return impl_.Emplace(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return impl_.TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key& key) { return impl_.Erase(key); }
+
+  iterator erase(const_iterator pos) { return impl_.Erase(pos); }
+
+  void swap(compact_flat_map& other) noexcept { impl_.Swap(other.impl_); }
+
+  // ----- Lookup ----- //
+
+  T& at(const Key& key) {
+    return const_cast<T&>(const_cast<const compact_flat_map*>(this)->at(key));
+  }
+
+  const T& at(const Key& key) const {
+    const auto it = impl_.Find(key);
+    if (it == impl_.End()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return impl_.TryEmplace(key).first->second; }
+
+  size_type count(const Key& key) const { return impl_.Count(key); }
+
+  iterator find(const Key& key) { return impl_.Find(key); }
+
+  const_iterator find(const Key& key) const { return impl_.Find(key); }
+
+  bool contains(const Key& key) const { return impl_.Contains(key); }
+
+  // ----- Bucket Interface ----- //
+
+  size_type bucket_count() const noexcept { return impl_.Capacity(); }
+
+  // ----- Hash Policy ----- //
+
+  float load_factor() const noexcept { return impl_.LoadFactor(); }
+
+  float max_load_factor() const noexcept { return impl_.MaxLoadFactor(); }
+
+  void max_load_factor(const float ml) { impl_.MaxLoadFactor(ml); }
+
+  void rehash(size_type count) { impl_.Rehash(count); }
+
+  void reserve(size_type count) { impl_.Reserve(count); }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return impl_.GetHashFunction(); }
+
+  key_equal key_eq() const { return impl_.GetKeyEqual(); }
+
+  friend bool operator==(const compact_flat_map& lhs,
+                         const compact_flat_map& rhs) {
+    return lhs.impl_ == rhs.impl_;
+  }
+
+  friend bool operator!=(const compact_flat_map& lhs,
+                         const compact_flat_map& rhs) {
+    return lhs.impl_ != rhs.impl_;
+  }
+
+ private:
+  ImplType impl_;
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void swap(compact_flat_map<Key, T, Hash, KeyEqual, Allocator>& lhs,
+          compact_flat_map<Key, T, Hash, KeyEqual, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace perroht
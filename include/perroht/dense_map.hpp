@@ -0,0 +1,327 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "perroht/perroht.hpp"
+
+namespace perroht {
+
+/// \brief A map whose elements are stored in a dense, contiguous array.
+/// A Perroht table maps each key to the index of its element in the array;
+/// thus, the Robin Hood displacements move a key and an index instead of a
+/// whole element, and resizing the table does not move the elements.
+/// Erasing an element moves the last element into its place, keeping the
+/// array packed; iterating the map is a linear pass over the array.
+/// \warning Insertions may invalidate iterators and references as the array
+/// grows (see reserve()); erasures invalidate the iterators and references to
+/// the last element.
+/// \tparam Index The type of the indices stored in the table. Limits the
+/// number of elements.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>,
+          typename Index = uint32_t>
+class dense_map {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using IndexTable =
+      Perroht<Key, Index, Hash, KeyEqual, true,
+              typename AllocTraits::template rebind_alloc<std::pair<Key, Index>>>;
+  using ValueArray =
+      std::vector<std::pair<Key, T>,
+                  typename AllocTraits::template rebind_alloc<std::pair<Key, T>>>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using index_type = Index;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename ValueArray::iterator;
+  using const_iterator = typename ValueArray::const_iterator;
+
+  dense_map() : dense_map(0) {}
+
+  explicit dense_map(size_type n, const Hash& hash = Hash(),
+                     const key_equal& equal = key_equal(),
+                     const allocator_type& alloc = allocator_type())
+      : index_(n, 0.875, hash, equal, alloc), values_(alloc) {
+    values_.reserve(n);
+  }
+
+  explicit dense_map(const allocator_type& alloc)
+      : dense_map(0, Hash(), key_equal(), alloc) {}
+
+  dense_map(const dense_map& other) = default;
+  dense_map(dense_map&& other) noexcept = default;
+
+  dense_map(const dense_map& other, const allocator_type& alloc)
+      : index_(other.index_, alloc), values_(other.values_, alloc) {}
+
+  dense_map(dense_map&& other, const allocator_type& alloc)
+      : index_(std::move(other.index_), alloc),
+        values_(std::move(other.values_), alloc) {}
+
+  ~dense_map() = default;
+
+  dense_map& operator=(const dense_map& other) = default;
+  dense_map& operator=(dense_map&& other) noexcept = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(values_.get_allocator());
+  }
+
+  // ----- Iterators ----- //
+
+  iterator begin() noexcept { return values_.begin(); }
+
+  const_iterator begin() const noexcept { return values_.begin(); }
+
+  const_iterator cbegin() const noexcept { return values_.cbegin(); }
+
+  iterator end() noexcept { return values_.end(); }
+
+  const_iterator end() const noexcept { return values_.end(); }
+
+  const_iterator cend() const noexcept { return values_.cend(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return values_.empty(); }
+
+  size_type size() const noexcept { return values_.size(); }
+
+  size_type max_size() const noexcept {
+    return std::min<size_type>(values_.max_size(),
+                               std::numeric_limits<Index>::max());
+  }
+
+  // ----- Modifiers ----- //
+
+  void clear() noexcept {
+    index_.Clear();
+    values_.clear();
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    value_type value(std::forward<Args>(args)...);
+    return insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return pTryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return pTryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  /// \brief Erase the element with the given key.
+  /// The last element is moved into the place of the erased one.
+  size_type erase(const Key& key) {
+    const auto it = index_.Find(key);
+    if (it == index_.End()) {
+      return 0;
+    }
+    pEraseAt(it);
+    return 1;
+  }
+
+  /// \brief Erase the element at the given position.
+  /// \return An iterator to the same position, which holds the element that
+  /// was the last one, or end() if the erased element was the last one.
+  iterator erase(const_iterator pos) {
+    const auto offset = pos - values_.cbegin();
+    pEraseAt(index_.Find(pos->first));
+    return values_.begin() + offset;
+  }
+
+  void swap(dense_map& other) noexcept {
+    index_.Swap(other.index_);
+    values_.swap(other.values_);
+  }
+
+  // ----- Lookup ----- //
+
+  T& at(const Key& key) {
+    return const_cast<T&>(const_cast<const dense_map*>(this)->at(key));
+  }
+
+  const T& at(const Key& key) const {
+    const auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  size_type count(const Key& key) const { return index_.Count(key); }
+
+  iterator find(const Key& key) {
+    const auto it = index_.Find(key);
+    return it == index_.End() ? end() : begin() + it->second;
+  }
+
+  const_iterator find(const Key& key) const {
+    const auto it = index_.Find(key);
+    return it == index_.End() ? end() : begin() + it->second;
+  }
+
+  bool contains(const Key& key) const { return index_.Contains(key); }
+
+  // ----- Element array ----- //
+
+  /// \brief Return a pointer to the packed element array of size() elements.
+  value_type* data() noexcept { return values_.data(); }
+
+  const value_type* data() const noexcept { return values_.data(); }
+
+  // ----- Bucket Interface ----- //
+
+  size_type bucket_count() const noexcept { return index_.Capacity(); }
+
+  // ----- Hash Policy ----- //
+
+  float load_factor() const noexcept { return index_.LoadFactor(); }
+
+  float max_load_factor() const noexcept { return index_.MaxLoadFactor(); }
+
+  void rehash(size_type count) { index_.Rehash(count); }
+
+  /// \brief Reserve space for at least count elements in both the table and
+  /// the element array.
+  void reserve(size_type count) {
+    index_.Reserve(count);
+    values_.reserve(count);
+  }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return index_.GetHashFunction(); }
+
+  key_equal key_eq() const { return index_.KeyEq(); }
+
+  template <typename K, typename V, typename H, typename E, typename A,
+            typename I>
+  friend bool operator==(const dense_map<K, V, H, E, A, I>& lhs,
+                         const dense_map<K, V, H, E, A, I>& rhs);
+
+ private:
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> pTryEmplace(K&& key, Args&&... args) {
+    assert(size() < max_size());
+    const auto [it, inserted] = index_.TryEmplace(key, Index(size()));
+    if (!inserted) {
+      return {begin() + it->second, false};
+    }
+    // If constructing the element throws, remove the table entry, which
+    // would refer past the end of the array. The key may have been moved
+    // from already; thus, the entry is erased by its position.
+    IndexEntryGuard guard{index_, it};
+    values_.emplace_back(std::piecewise_construct,
+                         std::forward_as_tuple(std::forward<K>(key)),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+    guard.committed = true;
+    return {std::prev(end()), true};
+  }
+
+  /// Erases a table entry on destruction unless committed is set.
+  struct IndexEntryGuard {
+    ~IndexEntryGuard() {
+      if (!committed) {
+        index.Erase(entry);
+      }
+    }
+
+    IndexTable& index;
+    typename IndexTable::Iterator entry;
+    bool committed{false};
+  };
+
+  /// Erase the element the given table entry refers to, moving the last
+  /// element into its place.
+  void pEraseAt(const typename IndexTable::Iterator it) {
+    const auto pos = size_type(it->second);
+    index_.Erase(it);
+    const auto last = size() - 1;
+    if (pos != last) {
+      values_[pos] = std::move(values_[last]);
+      index_.Find(values_[pos].first)->second = Index(pos);
+    }
+    values_.pop_back();
+  }
+
+  IndexTable index_;
+  ValueArray values_;
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator, typename Index>
+void swap(dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& lhs,
+          dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator, typename Index>
+bool operator==(const dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& lhs,
+                const dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& [key, value] : lhs) {
+    const auto it = rhs.find(key);
+    if (it == rhs.end() || !(it->second == value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator, typename Index>
+bool operator!=(const dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& lhs,
+                const dense_map<Key, T, Hash, KeyEqual, Allocator, Index>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht
@@ -14,13 +14,13 @@
 
 namespace perroht::prhdtls {
 template <typename Key, typename T, typename Hash, typename KeyEqual,
-          bool Embed, typename Allocator>
+          bool Embed, typename Allocator, typename Layout>
 class basic_unordered_map {
  private:
   using SelfType =
-      basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>;
+      basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>;
   using ImplType =
-      perroht::Perroht<Key, T, Hash, KeyEqual, Embed, Allocator>;
+      perroht::Perroht<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>;
   using KeyValueType = typename ImplType::KeyValueType;
 
  public:
@@ -72,13 +72,15 @@ class basic_unordered_map {
 
   ~basic_unordered_map() = default;
 
-  template <typename K, typename V, typename H, typename Q, bool E, typename A>
-  friend bool operator==(const basic_unordered_map<K, V, H, Q, E, A>& lhs,
-                         const basic_unordered_map<K, V, H, Q, E, A>& rhs);
+  template <typename K, typename V, typename H, typename Q, bool E, typename A,
+            typename L>
+  friend bool operator==(const basic_unordered_map<K, V, H, Q, E, A, L>& lhs,
+                         const basic_unordered_map<K, V, H, Q, E, A, L>& rhs);
 
-  template <typename K, typename V, typename H, typename Q, bool E, typename A>
-  friend bool operator!=(const basic_unordered_map<K, V, H, Q, E, A>& lhs,
-                         const basic_unordered_map<K, V, H, Q, E, A>& rhs);
+  template <typename K, typename V, typename H, typename Q, bool E, typename A,
+            typename L>
+  friend bool operator!=(const basic_unordered_map<K, V, H, Q, E, A, L>& lhs,
+                         const basic_unordered_map<K, V, H, Q, E, A, L>& rhs);
 
   basic_unordered_map& operator=(const basic_unordered_map& other) = default;
   basic_unordered_map& operator=(basic_unordered_map&& other) noexcept =
@@ -212,26 +214,31 @@ class basic_unordered_map {
 };
 
 template <typename Key, typename T, typename Hash, typename KeyEqual,
-          bool Embed, typename Allocator>
-void swap(basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>& lhs,
-          basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>&
-              rhs) noexcept(noexcept(lhs.swap(rhs))) {
+          bool Embed, typename Allocator, typename Layout>
+void swap(
+    basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>& lhs,
+    basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) noexcept(noexcept(lhs.swap(rhs))) {
   lhs.swap(rhs);
 }
 
 template <typename Key, typename T, typename Hash, typename KeyEqual,
-          bool Embed, typename Allocator>
+          bool Embed, typename Allocator, typename Layout>
 bool operator==(
-    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>& lhs,
-    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>& rhs) {
+    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>&
+        lhs,
+    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) {
   return lhs.impl_ == rhs.impl_;
 }
 
 template <typename Key, typename T, typename Hash, typename KeyEqual,
-          bool Embed, typename Allocator>
+          bool Embed, typename Allocator, typename Layout>
 bool operator!=(
-    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>& lhs,
-    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator>& rhs) {
+    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>&
+        lhs,
+    const basic_unordered_map<Key, T, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) {
   return lhs.impl_ != rhs.impl_;
 }
 
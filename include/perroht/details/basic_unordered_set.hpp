@@ -14,11 +14,11 @@
 
 namespace perroht::prhdtls {
 template <typename Key, typename Hash, typename KeyEqual, bool Embed,
-          typename Allocator>
+          typename Allocator, typename Layout>
 class basic_unordered_set {
  private:
   using ImplType = perroht::Perroht<Key, perroht::VoidValue, Hash, KeyEqual,
-                                    Embed, Allocator>;
+                                    Embed, Allocator, Layout>;
   using KeyValueType = typename ImplType::KeyValueType;
 
  public:
@@ -70,13 +70,15 @@ class basic_unordered_set {
 
   ~basic_unordered_set() = default;
 
-  template <typename K, typename H, typename Q, bool E, typename A>
-  friend bool operator==(const basic_unordered_set<K, H, Q, E, A>& lhs,
-                         const basic_unordered_set<K, H, Q, E, A>& rhs);
+  template <typename K, typename H, typename Q, bool E, typename A,
+            typename L>
+  friend bool operator==(const basic_unordered_set<K, H, Q, E, A, L>& lhs,
+                         const basic_unordered_set<K, H, Q, E, A, L>& rhs);
 
-  template <typename K, typename H, typename Q, bool E, typename A>
-  friend bool operator!=(const basic_unordered_set<K, H, Q, E, A>& lhs,
-                         const basic_unordered_set<K, H, Q, E, A>& rhs);
+  template <typename K, typename H, typename Q, bool E, typename A,
+            typename L>
+  friend bool operator!=(const basic_unordered_set<K, H, Q, E, A, L>& lhs,
+                         const basic_unordered_set<K, H, Q, E, A, L>& rhs);
 
   basic_unordered_set& operator=(const basic_unordered_set& other) = default;
   basic_unordered_set& operator=(basic_unordered_set&& other) noexcept =
@@ -182,26 +184,31 @@ class basic_unordered_set {
 };
 
 template <typename Key, typename Hash, typename KeyEqual, bool Embed,
-          typename Allocator>
-void swap(basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>& lhs,
-          basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>&
-              rhs) noexcept(noexcept(lhs.swap(rhs))) {
+          typename Allocator, typename Layout>
+void swap(
+    basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>& lhs,
+    basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) noexcept(noexcept(lhs.swap(rhs))) {
   lhs.swap(rhs);
 }
 
 template <typename Key, typename Hash, typename KeyEqual, bool Embed,
-          typename Allocator>
+          typename Allocator, typename Layout>
 bool operator==(
-    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>& lhs,
-    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>& rhs) {
+    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>&
+        lhs,
+    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) {
   return lhs.impl_ == rhs.impl_;
 }
 
 template <typename Key, typename Hash, typename KeyEqual, bool Embed,
-          typename Allocator>
+          typename Allocator, typename Layout>
 bool operator!=(
-    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>& lhs,
-    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator>& rhs) {
+    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>&
+        lhs,
+    const basic_unordered_set<Key, Hash, KeyEqual, Embed, Allocator, Layout>&
+        rhs) {
   return !(lhs == rhs);
 }
 }  // namespace perroht::prhdtls
\ No newline at end of file
@@ -0,0 +1,340 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "file.hpp"
+#include "type_traits.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief An append-only change log that records the insertions, updates,
+/// and erasures applied to a table, each with a sequence number.
+/// Records are written to binary segment files in a directory.
+/// A new segment is started when the current one reaches the maximum size,
+/// and the oldest segments are removed when the number of segments exceeds
+/// the maximum; thus, the log keeps the most recent changes only.
+/// Records are buffered in memory and written by Flush(); a record is
+/// durable once Flush(true) returns true.
+/// As records are stored as raw bytes, the key and key-value types must be
+/// trivially copyable.
+template <typename KeyType, typename KeyValueType>
+class ChangeLog {
+  static_assert(IsBitwiseCopyableV<KeyType> && IsBitwiseCopyableV<KeyValueType>,
+                "ChangeLog requires trivially copyable keys and values");
+
+ public:
+  using SizeType = std::size_t;
+  using SequenceType = uint64_t;
+
+  enum class EventType : uint8_t {
+    kInsert = 1,
+    kUpdate = 2,
+    kErase = 3,
+    kClear = 4,
+  };
+
+  /// \brief Open the change log in the given directory, creating it if it
+  /// does not exist. Sequence numbers continue from the existing records.
+  /// \param max_segment_size The maximum size of a segment file in bytes.
+  /// \param max_num_segments The maximum number of segment files to keep.
+  explicit ChangeLog(std::string dir,
+                     const SizeType max_segment_size = SizeType(64) << 20,
+                     const SizeType max_num_segments = 16)
+      : dir_(std::move(dir)),
+        max_segment_size_(std::max(max_segment_size, kRecordSize)),
+        max_num_segments_(std::max(max_num_segments, SizeType(1))) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir_, ec);
+    if (ec) {
+      good_ = false;
+      return;
+    }
+    const auto segments = pListSegments(dir_);
+    if (!segments.empty()) {
+      pReadSegment(segments.back().second, [this](const SequenceType seq,
+                                                 EventType, const std::byte*) {
+        last_sequence_ = seq;
+        return true;
+      });
+      last_sequence_ = std::max(last_sequence_, segments.back().first - 1);
+    }
+  }
+
+  ~ChangeLog() noexcept {
+    Flush(true);
+    pCloseSegment();
+  }
+
+  ChangeLog(const ChangeLog&) = delete;
+  ChangeLog& operator=(const ChangeLog&) = delete;
+
+  /// \brief Return false if an I/O error has occurred.
+  inline bool Good() const noexcept { return good_; }
+
+  /// \brief Return the sequence number of the last recorded event.
+  /// 0 if no event has been recorded.
+  inline SequenceType LastSequence() const noexcept { return last_sequence_; }
+
+  inline bool RecordInsert(const KeyValueType& key_value) {
+    return pAppend(EventType::kInsert, &key_value, sizeof(KeyValueType));
+  }
+
+  inline bool RecordUpdate(const KeyValueType& key_value) {
+    return pAppend(EventType::kUpdate, &key_value, sizeof(KeyValueType));
+  }
+
+  inline bool RecordErase(const KeyType& key) {
+    return pAppend(EventType::kErase, &key, sizeof(KeyType));
+  }
+
+  inline bool RecordClear() { return pAppend(EventType::kClear, nullptr, 0); }
+
+  /// \brief Write the buffered records to the current segment file.
+  /// \param durable If true, also flush the file to the storage.
+  bool Flush(const bool durable = true) {
+    if (!pWriteBuffer()) {
+      return false;
+    }
+    if (durable && fd_ != -1 && !os_fsync(fd_)) {
+      good_ = false;
+    }
+    return good_;
+  }
+
+  /// \brief Read the events whose sequence numbers are larger than
+  /// after_sequence from the log in the given directory, in order.
+  /// Calls func(sequence, type, key_value, key) for each event, where
+  /// key_value is non-null for insertions and updates, and key is non-null
+  /// for erasures.
+  /// \param last_sequence If not null, the sequence number of the last event
+  /// read is stored (after_sequence if there was none).
+  /// \return False if some of the requested events are no longer in the log,
+  /// i.e., they were removed to bound the log size or were lost.
+  template <typename Func>
+  static bool ReadEvents(const std::string& dir,
+                         const SequenceType after_sequence, Func&& func,
+                         SequenceType* const last_sequence = nullptr) {
+    SequenceType next = after_sequence + 1;
+    const auto segments = pListSegments(dir);
+    bool ok = true;
+    for (std::size_t i = 0; i < segments.size() && ok; ++i) {
+      if (i + 1 < segments.size() && segments[i + 1].first <= next) {
+        continue;  // All events in this segment have been applied.
+      }
+      pReadSegment(segments[i].second, [&](const SequenceType seq,
+                                          const EventType type,
+                                          const std::byte* const payload) {
+        if (seq < next) {
+          return true;
+        }
+        if (seq != next) {
+          ok = false;  // Missing events
+          return false;
+        }
+        alignas(KeyValueType) std::byte kv_buf[sizeof(KeyValueType)];
+        alignas(KeyType) std::byte key_buf[sizeof(KeyType)];
+        const KeyValueType* kv = nullptr;
+        const KeyType* key = nullptr;
+        if (type == EventType::kInsert || type == EventType::kUpdate) {
+          std::memcpy(kv_buf, payload, sizeof(KeyValueType));
+          kv = std::launder(reinterpret_cast<const KeyValueType*>(kv_buf));
+        } else if (type == EventType::kErase) {
+          std::memcpy(key_buf, payload, sizeof(KeyType));
+          key = std::launder(reinterpret_cast<const KeyType*>(key_buf));
+        }
+        func(seq, type, kv, key);
+        ++next;
+        return true;
+      });
+    }
+    if (last_sequence) {
+      *last_sequence = next - 1;
+    }
+    return ok;
+  }
+
+ private:
+  static constexpr SizeType kHeaderSize = 16;
+  static constexpr SizeType kPayloadSize =
+      (std::max(sizeof(KeyValueType), sizeof(KeyType)) + 7) / 8 * 8;
+  static constexpr SizeType kRecordSize = kHeaderSize + kPayloadSize;
+  static constexpr SizeType kBufferSize = SizeType(1) << 16;
+
+  // Record header layout: sequence (8B), checksum (4B), type (1B),
+  // padding (3B). The checksum covers the whole record except itself.
+  static constexpr SizeType kSequenceOffset = 0;
+  static constexpr SizeType kChecksumOffset = 8;
+  static constexpr SizeType kTypeOffset = 12;
+
+  using SegmentList = std::vector<std::pair<SequenceType, std::string>>;
+
+  /// Read the valid records in the given segment file until func returns
+  /// false. Stops at the first torn or corrupted record.
+  template <typename Func>
+  static void pReadSegment(const std::string& path, Func&& func) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return;
+    }
+    std::vector<std::byte> buf(kRecordSize * 256);
+    bool done = false;
+    while (!done) {
+      const auto n = os_read(fd, buf.data(), buf.size());
+      if (n <= 0) {
+        break;
+      }
+      const auto num_records = SizeType(n) / kRecordSize;
+      for (SizeType i = 0; i < num_records && !done; ++i) {
+        const auto* const record = buf.data() + i * kRecordSize;
+        uint32_t checksum = 0;
+        std::memcpy(&checksum, record + kChecksumOffset, sizeof(checksum));
+        if (checksum != pChecksum(record)) {
+          done = true;
+          break;
+        }
+        SequenceType seq = 0;
+        std::memcpy(&seq, record + kSequenceOffset, sizeof(seq));
+        const auto type = static_cast<EventType>(record[kTypeOffset]);
+        done = !func(seq, type, record + kHeaderSize);
+      }
+      done |= SizeType(n) % kRecordSize != 0;
+    }
+    ::close(fd);
+  }
+
+  static SegmentList pListSegments(const std::string& dir) {
+    SegmentList segments;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+      const auto name = entry.path().filename().string();
+      unsigned long long first = 0;
+      char tail = 0;
+      if (std::sscanf(name.c_str(), "segment-%llu.log%c", &first, &tail) ==
+          1) {
+        segments.emplace_back(first, entry.path().string());
+      }
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+  }
+
+  static std::string pSegmentPath(const std::string& dir,
+                                  const SequenceType first) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "segment-%020llu.log",
+                  static_cast<unsigned long long>(first));
+    return (std::filesystem::path(dir) / name).string();
+  }
+
+  // FNV-1a
+  static uint32_t pChecksum(const std::byte* const record) {
+    uint32_t hash = 2166136261u;
+    for (SizeType i = 0; i < kRecordSize; ++i) {
+      if (i >= kChecksumOffset && i < kChecksumOffset + 4) {
+        continue;
+      }
+      hash ^= uint32_t(record[i]);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+  bool pAppend(const EventType type, const void* const payload,
+               const SizeType size) {
+    if (!good_) {
+      return false;
+    }
+    if (fd_ == -1 ||
+        segment_size_ + buffer_.size() + kRecordSize > max_segment_size_) {
+      if (!pWriteBuffer() || !pOpenSegment(last_sequence_ + 1)) {
+        return false;
+      }
+    }
+
+    const auto seq = ++last_sequence_;
+    const auto offset = buffer_.size();
+    buffer_.resize(offset + kRecordSize, std::byte(0));
+    auto* const record = buffer_.data() + offset;
+    std::memcpy(record + kSequenceOffset, &seq, sizeof(seq));
+    record[kTypeOffset] = static_cast<std::byte>(type);
+    if (payload) {
+      std::memcpy(record + kHeaderSize, payload, size);
+    }
+    const auto checksum = pChecksum(record);
+    std::memcpy(record + kChecksumOffset, &checksum, sizeof(checksum));
+
+    if (buffer_.size() >= kBufferSize) {
+      return pWriteBuffer();
+    }
+    return true;
+  }
+
+  bool pWriteBuffer() {
+    if (buffer_.empty()) {
+      return good_;
+    }
+    if (!os_write(fd_, buffer_.data(), buffer_.size())) {
+      good_ = false;
+    }
+    segment_size_ += buffer_.size();
+    buffer_.clear();
+    return good_;
+  }
+
+  /// Start a new segment whose first record has the given sequence number,
+  /// and remove the oldest segments if there are too many.
+  bool pOpenSegment(const SequenceType first) {
+    if (fd_ != -1 && !os_fsync(fd_)) {
+      good_ = false;
+    }
+    pCloseSegment();
+    const auto path = pSegmentPath(dir_, first);
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ == -1) {
+      good_ = false;
+      return false;
+    }
+    segment_size_ = 0;
+
+    auto segments = pListSegments(dir_);
+    for (SizeType i = 0; i + max_num_segments_ < segments.size(); ++i) {
+      std::error_code ec;
+      std::filesystem::remove(segments[i].second, ec);
+    }
+    os_fsync_directory(dir_.c_str());
+    return good_;
+  }
+
+  void pCloseSegment() noexcept {
+    if (fd_ != -1) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  std::string dir_;
+  SizeType max_segment_size_;
+  SizeType max_num_segments_;
+  SequenceType last_sequence_{0};
+  int fd_{-1};
+  SizeType segment_size_{0};
+  std::vector<std::byte> buffer_{};
+  bool good_{true};
+};
+
+}  // namespace perroht::prhdtls
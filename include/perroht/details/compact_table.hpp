@@ -0,0 +1,668 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "flat_probing.hpp"
+#include "header.hpp"
+#include "key_value_traits.hpp"
+#include "memory.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief Holds an object of type T.
+/// If T is stateless (empty and default constructible), the object is not
+/// stored; a class that derives from CompactMember does not grow (empty base
+/// optimization) and a default constructed object is returned instead.
+/// kTag distinguishes the bases of a class that holds several members of the
+/// same type.
+template <typename T, int kTag,
+          bool kStateless =
+              std::is_empty_v<T> && std::is_default_constructible_v<T>>
+class CompactMember {
+ public:
+  CompactMember() = default;
+  explicit CompactMember(const T&) {}
+
+  T Get() const { return T(); }
+
+  void Set(const T&) {}
+
+  void SwapMember(CompactMember&) noexcept {}
+};
+
+template <typename T, int kTag>
+class CompactMember<T, kTag, false> {
+ public:
+  CompactMember() = default;
+  explicit CompactMember(const T& value) : value_(value) {}
+
+  const T& Get() const { return value_; }
+
+  void Set(const T& value) { value_ = value; }
+
+  void SwapMember(CompactMember& other) noexcept {
+    using std::swap;
+    swap(value_, other.value_);
+  }
+
+ private:
+  T value_;
+};
+
+/// \brief A Robin Hood hash table whose container object is a compact
+/// handle.
+/// The handle holds a pointer to the table and the number of elements only;
+/// the capacity and the max load factor are stored in a block at the
+/// beginning of the table allocation, and a stateless hasher, key equal, or
+/// allocator is not stored at all. Thus, the handle is 16 bytes with
+/// std::allocator, and a stateful allocator, such as a persistent memory
+/// allocator, adds its own size. This is intended for containers nested in
+/// other containers, e.g., sets in a map, where the per-container overhead
+/// would exceed the elements.
+/// The block is followed by the header bytes and then by the elements,
+/// which are aligned. As the block is a part of the table, an empty
+/// container without a table uses the default max load factor.
+/// A header saturates at the largest probe distance it can hold; longer
+/// distances are recomputed from the hash value while probing with
+/// FlatProbing.
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+          typename Alloc>
+class CompactTable
+    : private CompactMember<Hash, 0>,
+      private CompactMember<KeyEqual, 1>,
+      private CompactMember<RebindAlloc<Alloc, typename KeyValueTraits<
+                                                   Key, Value,
+                                                   true>::KeyValueType>,
+                            2> {
+ private:
+  using KVTraits = KeyValueTraits<Key, Value, true>;
+
+ public:
+  using KeyType = typename KVTraits::KeyType;
+  using ValueType = typename KVTraits::ValueType;
+  using KeyValueType = typename KVTraits::KeyValueType;
+  using Hasher = Hash;
+  using KeyEqualOp = KeyEqual;
+  using SizeType = std::size_t;
+  using DifferentType = std::ptrdiff_t;
+  using Allocator = RebindAlloc<Alloc, KeyValueType>;
+
+ private:
+  using SelfType = CompactTable<Key, Value, Hash, KeyEqual, Alloc>;
+  using ElementType = KeyValueType;
+  friend class FlatIterator<SelfType, false>;
+  friend class FlatIterator<SelfType, true>;
+
+ public:
+  template <bool IsConst>
+  using BaseIterator = FlatIterator<SelfType, IsConst>;
+  using Iterator = BaseIterator<false>;
+  using ConstIterator = BaseIterator<true>;
+
+  static constexpr float kDefaultMaxLoadFactor = 0.875;
+
+ private:
+  using HasherMember = CompactMember<Hash, 0>;
+  using KeyEqualMember = CompactMember<KeyEqual, 1>;
+  using AllocatorMember = CompactMember<Allocator, 2>;
+  using ByteAllocator = RebindAlloc<Allocator, std::byte>;
+  using BytePointer = typename AllocTraits<ByteAllocator>::pointer;
+
+  /// The fields that are stored in the table allocation.
+  struct Block {
+    SizeType capacity;
+    float max_load_factor;
+  };
+
+ public:
+  explicit CompactTable(const SizeType capacity = 0,
+                        const float max_load_factor = kDefaultMaxLoadFactor,
+                        const Hasher& hash = Hasher(),
+                        const KeyEqualOp& equal = KeyEqualOp(),
+                        const Allocator& alloc = Allocator())
+      : HasherMember(hash), KeyEqualMember(equal), AllocatorMember(alloc) {
+    if (FlatCapacity::CleanseMaxLoadFactor(max_load_factor) !=
+        kDefaultMaxLoadFactor) {
+      MaxLoadFactor(max_load_factor);
+    }
+    Reserve(capacity);
+  }
+
+  CompactTable(const CompactTable& other)
+      : CompactTable(other,
+                     AllocTraits<Allocator>::
+                         select_on_container_copy_construction(
+                             other.GetAllocator())) {}
+
+  CompactTable(const CompactTable& other, const Allocator& alloc)
+      : HasherMember(other.GetHashFunction()),
+        KeyEqualMember(other.GetKeyEqual()),
+        AllocatorMember(alloc) {
+    pCopyTable(other);
+  }
+
+  CompactTable(CompactTable&& other) noexcept
+      : HasherMember(other.GetHashFunction()),
+        KeyEqualMember(other.GetKeyEqual()),
+        AllocatorMember(other.GetAllocator()),
+        table_(std::move(other.table_)),
+        size_(other.size_) {
+    other.pForgetTable();
+  }
+
+  CompactTable(CompactTable&& other, const Allocator& alloc)
+      : HasherMember(other.GetHashFunction()),
+        KeyEqualMember(other.GetKeyEqual()),
+        AllocatorMember(alloc) {
+    if (GetAllocator() == other.GetAllocator()) {
+      size_ = other.size_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    } else {
+      pCopyTable(other);
+    }
+  }
+
+  ~CompactTable() noexcept { pDestroyTable(); }
+
+  CompactTable& operator=(const CompactTable& other) {
+    if (this != &other) {
+      CompactTable tmp(other, GetAllocator());
+      Swap(tmp);
+    }
+    return *this;
+  }
+
+  CompactTable& operator=(CompactTable&& other) noexcept {
+    if (this != &other) {
+      pDestroyTable();
+      HasherMember::Set(other.GetHashFunction());
+      KeyEqualMember::Set(other.GetKeyEqual());
+      AllocatorMember::Set(other.GetAllocator());
+      size_ = other.size_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    }
+    return *this;
+  }
+
+  Allocator GetAllocator() const { return AllocatorMember::Get(); }
+
+  Hasher GetHashFunction() const { return HasherMember::Get(); }
+
+  KeyEqualOp GetKeyEqual() const { return KeyEqualMember::Get(); }
+
+  // ----- Iterators ----- //
+
+  Iterator Begin() { return Iterator(pFirstPosition(0), this); }
+
+  ConstIterator Begin() const {
+    return ConstIterator(pFirstPosition(0), this);
+  }
+
+  Iterator End() { return Iterator(Capacity(), this); }
+
+  ConstIterator End() const { return ConstIterator(Capacity(), this); }
+
+  // ----- Capacity ----- //
+
+  SizeType Size() const { return size_; }
+
+  bool Empty() const { return size_ == 0; }
+
+  SizeType MaxSize() const noexcept {
+    return AllocTraits<Allocator>::max_size(GetAllocator());
+  }
+
+  SizeType Capacity() const { return table_ ? pBlock().capacity : 0; }
+
+  // ----- Modifiers ----- //
+
+  void Clear() noexcept {
+    if (!table_) {
+      return;
+    }
+    const auto capacity = Capacity();
+    auto* const headers = pHeaders(pTable());
+    auto* const elements = pElements(pTable(), capacity);
+    auto alloc = GetAllocator();
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      if (!headers[pos].Empty()) {
+        AllocTraits<Allocator>::destroy(alloc, elements + pos);
+        headers[pos].Clear();
+      }
+    }
+    size_ = 0;
+  }
+
+  /// \brief Insert an element constructed from args if there is no element
+  /// with the key.
+  template <typename... Args>
+  std::pair<Iterator, bool> TryEmplace(const KeyType& key, Args&&... args) {
+    if (const auto pos = pLocate(key); pos != Capacity()) {
+      return {Iterator(pos, this), false};
+    }
+    Reserve(size_ + 1);
+    const auto pos =
+        FlatProbing::Place(pSlots(pTable()),
+                           pMakeElement(key, std::forward<Args>(args)...));
+    ++size_;
+    return {Iterator(pos, this), true};
+  }
+
+  std::pair<Iterator, bool> Insert(const KeyValueType& key_value) {
+    return Insert(pConstructElement(key_value));
+  }
+
+  std::pair<Iterator, bool> Insert(KeyValueType&& key_value) {
+    if (const auto pos = pLocate(pKey(key_value)); pos != Capacity()) {
+      return {Iterator(pos, this), false};
+    }
+    Reserve(size_ + 1);
+    const auto pos = FlatProbing::Place(pSlots(pTable()), std::move(key_value));
+    ++size_;
+    return {Iterator(pos, this), true};
+  }
+
+  template <typename... Args>
+  std::pair<Iterator, bool> Emplace(Args&&... args) {
+    return Insert(pConstructElement(std::forward<Args>(args)...));
+  }
+
+  SizeType Erase(const KeyType& key) {
+    const auto pos = pLocate(key);
+    if (pos == Capacity()) {
+      return 0;
+    }
+    pEraseAt(pos);
+    return 1;
+  }
+
+  /// \brief Erase the element at the given position.
+  /// \return An iterator to the element that follows the erased one.
+  Iterator Erase(const ConstIterator it) {
+    const auto pos = it.Position();
+    if (pos == Capacity()) {
+      return End();
+    }
+    pEraseAt(pos);
+    // The position is visited again as it may hold a shifted element.
+    return Iterator(pFirstPosition(pos), this);
+  }
+
+  void Swap(CompactTable& other) noexcept {
+    using std::swap;
+    if constexpr (AllocTraits<
+                      Allocator>::propagate_on_container_swap::value) {
+      AllocatorMember::SwapMember(other);
+    }
+    HasherMember::SwapMember(other);
+    KeyEqualMember::SwapMember(other);
+    swap(size_, other.size_);
+    swap(table_, other.table_);
+  }
+
+  // ----- Lookup ----- //
+
+  Iterator Find(const KeyType& key) { return Iterator(pLocate(key), this); }
+
+  ConstIterator Find(const KeyType& key) const {
+    return ConstIterator(pLocate(key), this);
+  }
+
+  SizeType Count(const KeyType& key) const { return Contains(key) ? 1 : 0; }
+
+  bool Contains(const KeyType& key) const {
+    return pLocate(key) != Capacity();
+  }
+
+  // ----- Hash Policy ----- //
+
+  float LoadFactor() const {
+    return Empty() ? 0.0f : float(size_) / float(Capacity());
+  }
+
+  float MaxLoadFactor() const {
+    return table_ ? pBlock().max_load_factor : kDefaultMaxLoadFactor;
+  }
+
+  /// \brief Set the max load factor.
+  /// Allocates a table if there is none as the table holds the value.
+  void MaxLoadFactor(const float max_load_factor) {
+    if (!table_) {
+      pRehash(FlatCapacity::kMinCapacity);
+    }
+    pBlock().max_load_factor =
+        FlatCapacity::CleanseMaxLoadFactor(max_load_factor);
+    Reserve(size_);
+  }
+
+  /// \brief Make the table large enough to hold n elements without growing.
+  void Reserve(const SizeType n) {
+    if (!pEnoughCapacity(n, Capacity())) {
+      pRehash(pNextCapacity(n));
+    }
+  }
+
+  /// \brief Rebuild the table with at least the given number of positions,
+  /// or the smallest capacity that holds the current elements, whichever is
+  /// larger.
+  void Rehash(const SizeType capacity) {
+    const auto new_capacity =
+        FlatCapacity::ForRehash(size_, capacity, MaxLoadFactor());
+    if (new_capacity != Capacity()) {
+      pRehash(new_capacity);
+    }
+  }
+
+  template <typename K, typename V, typename H, typename E, typename A>
+  friend bool operator==(const CompactTable<K, V, H, E, A>& lhs,
+                         const CompactTable<K, V, H, E, A>& rhs);
+
+ private:
+  static const KeyType& pKey(const KeyValueType& key_value) {
+    return KVTraits::GetKey(key_value);
+  }
+
+  // ----- Table Layout ----- //
+  // [Block][Header x capacity][padding][KeyValueType x capacity]
+
+  static constexpr SizeType kHeadersOffset = sizeof(Block);
+
+  static constexpr SizeType pElementsOffset(const SizeType capacity) {
+    constexpr SizeType kAlign = alignof(KeyValueType);
+    return (kHeadersOffset + sizeof(Header) * capacity + kAlign - 1) /
+           kAlign * kAlign;
+  }
+
+  static constexpr SizeType pMemorySize(const SizeType capacity) {
+    return pElementsOffset(capacity) + sizeof(KeyValueType) * capacity;
+  }
+
+  std::byte* pTable() const { return ToAddress(table_); }
+
+  Block& pBlock() const { return *reinterpret_cast<Block*>(pTable()); }
+
+  static Header* pHeaders(std::byte* const table) {
+    return reinterpret_cast<Header*>(table + kHeadersOffset);
+  }
+
+  static KeyValueType* pElements(std::byte* const table,
+                                 const SizeType capacity) {
+    return reinterpret_cast<KeyValueType*>(table + pElementsOffset(capacity));
+  }
+
+  // ----- Probing ----- //
+
+  /// The positions of a table for FlatProbing.
+  struct Slots {
+    const CompactTable& self;
+    SizeType capacity;
+    Header* headers;
+    KeyValueType* elements;
+
+    SizeType Capacity() const { return capacity; }
+
+    bool Empty(const SizeType pos) const { return headers[pos].Empty(); }
+
+    SizeType IdealPosition(const KeyValueType& key_value) const {
+      return self.pIdealPosition(pKey(key_value), capacity);
+    }
+
+    /// Distances that do not fit in a header are computed from the hash
+    /// value.
+    SizeType ProbeDistance(const SizeType pos) const {
+      const SizeType dist = headers[pos].GetProbeDistance();
+      if (dist < Header::MaxProbeDistance()) {
+        return dist;
+      }
+      return (pos - IdealPosition(elements[pos])) & (capacity - 1);
+    }
+
+    void Put(const SizeType pos, KeyValueType&& key_value,
+             const SizeType dist) const {
+      auto alloc = self.GetAllocator();
+      AllocTraits<Allocator>::construct(alloc, elements + pos,
+                                        std::move(key_value));
+      pSetProbeDistance(headers[pos], dist);
+    }
+
+    void Exchange(const SizeType pos, KeyValueType& key_value,
+                  const SizeType dist) const {
+      using std::swap;
+      swap(elements[pos], key_value);
+      pSetProbeDistance(headers[pos], dist);
+    }
+
+    void Shift(const SizeType dst, const SizeType src,
+               const SizeType dist) const {
+      elements[dst] = std::move(elements[src]);
+      pSetProbeDistance(headers[dst], dist);
+    }
+
+    void MakeEmpty(const SizeType pos) const {
+      auto alloc = self.GetAllocator();
+      AllocTraits<Allocator>::destroy(alloc, elements + pos);
+      headers[pos].Clear();
+    }
+  };
+
+  Slots pSlots(std::byte* const table) const {
+    const auto capacity = reinterpret_cast<Block*>(table)->capacity;
+    return Slots{*this, capacity, pHeaders(table),
+                 pElements(table, capacity)};
+  }
+
+  bool pEnoughCapacity(const SizeType n, const SizeType capacity) const {
+    return FlatCapacity::Enough(n, capacity, MaxLoadFactor());
+  }
+
+  SizeType pNextCapacity(const SizeType n) const {
+    return FlatCapacity::Next(n, MaxLoadFactor());
+  }
+
+  /// Return the first position at or after pos that holds an element or the
+  /// capacity.
+  SizeType pFirstPosition(const SizeType pos) const {
+    if (!table_) {
+      return 0;
+    }
+    return FlatProbing::FirstOccupied(pSlots(pTable()), pos);
+  }
+
+  SizeType pNextPosition(const SizeType pos) const {
+    return pFirstPosition(pos + 1);
+  }
+
+  KeyValueType& pElementAt(const SizeType pos) {
+    return pElements(pTable(), Capacity())[pos];
+  }
+
+  const KeyValueType& pElementAt(const SizeType pos) const {
+    return pElements(pTable(), Capacity())[pos];
+  }
+
+  SizeType pIdealPosition(const KeyType& key, const SizeType capacity) const {
+    return GetHashFunction()(key) & (capacity - 1);
+  }
+
+  static void pSetProbeDistance(Header& header, const SizeType dist) {
+    header.SetProbeDistance(
+        std::min(dist, SizeType(Header::MaxProbeDistance())));
+  }
+
+  /// Locate the element with the key.
+  /// Return the capacity if it is not found.
+  SizeType pLocate(const KeyType& key) const {
+    if (size_ == 0) {
+      return Capacity();
+    }
+    const auto slots = pSlots(pTable());
+    const auto key_equal = GetKeyEqual();
+    return FlatProbing::Locate(
+        slots, pIdealPosition(key, slots.capacity), [&](const SizeType pos) {
+          return key_equal(pKey(slots.elements[pos]), key);
+        });
+  }
+
+  void pEraseAt(const SizeType pos) {
+    FlatProbing::Erase(pSlots(pTable()), pos);
+    --size_;
+  }
+
+  template <typename... Args>
+  KeyValueType pMakeElement(const KeyType& key, Args&&... args) const {
+    if constexpr (std::is_same_v<ValueType, VoidValue>) {
+      static_assert(sizeof...(Args) == 0);
+      return pConstructElement(key);
+    } else {
+      return pConstructElement(
+          std::piecewise_construct, std::forward_as_tuple(key),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+  }
+
+  /// Construct an element through the allocator so that
+  /// std::scoped_allocator_adaptor passes itself to the key and the value
+  /// (uses-allocator construction). FlatProbing::Place moves the element into
+  /// the table.
+  template <typename... Args>
+  KeyValueType pConstructElement(Args&&... args) const {
+    auto alloc = GetAllocator();
+    alignas(KeyValueType) std::byte buffer[sizeof(KeyValueType)];
+    auto* const tmp = reinterpret_cast<KeyValueType*>(buffer);
+    AllocTraits<Allocator>::construct(alloc, tmp, std::forward<Args>(args)...);
+    KeyValueType key_value(std::move(*tmp));
+    AllocTraits<Allocator>::destroy(alloc, tmp);
+    return key_value;
+  }
+
+  // ----- Allocation ----- //
+
+  /// Allocate a table with empty positions.
+  BytePointer pAllocateTable(const SizeType capacity,
+                             const float max_load_factor) const {
+    ByteAllocator alloc(GetAllocator());
+    auto table =
+        AllocTraits<ByteAllocator>::allocate(alloc, pMemorySize(capacity));
+    if (!table) {
+      assert(false);
+      std::abort();
+    }
+    auto* const raw = ToAddress(table);
+    new (raw) Block{capacity, max_load_factor};
+    auto* const headers = pHeaders(raw);
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      new (headers + pos) Header();
+    }
+    return table;
+  }
+
+  /// Destroy the elements of a table and deallocate it.
+  void pDeallocateTable(BytePointer table) const {
+    if (!table) {
+      return;
+    }
+    auto* const raw = ToAddress(table);
+    const auto capacity = reinterpret_cast<Block*>(raw)->capacity;
+    const auto* const headers = pHeaders(raw);
+    auto* const elements = pElements(raw, capacity);
+    auto alloc = GetAllocator();
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      if (!headers[pos].Empty()) {
+        AllocTraits<Allocator>::destroy(alloc, elements + pos);
+      }
+    }
+    ByteAllocator byte_alloc(alloc);
+    AllocTraits<ByteAllocator>::deallocate(byte_alloc, table,
+                                           pMemorySize(capacity));
+  }
+
+  void pDestroyTable() {
+    pDeallocateTable(table_);
+    pForgetTable();
+  }
+
+  void pForgetTable() {
+    table_ = nullptr;
+    size_ = 0;
+  }
+
+  /// Move the elements to a new table of the given capacity.
+  /// A capacity of 0 releases the table.
+  void pRehash(const SizeType new_capacity) {
+    assert(pEnoughCapacity(size_, new_capacity));
+    BytePointer new_table = nullptr;
+    if (new_capacity > 0) {
+      new_table = pAllocateTable(new_capacity, MaxLoadFactor());
+      const auto capacity = Capacity();
+      for (SizeType pos = 0; pos < capacity; ++pos) {
+        if (!pHeaders(pTable())[pos].Empty()) {
+          FlatProbing::Place(pSlots(ToAddress(new_table)),
+                             std::move(pElements(pTable(), capacity)[pos]));
+        }
+      }
+    }
+    pDeallocateTable(table_);
+    table_ = new_table;
+  }
+
+  /// Copy the table of other, keeping the positions of the elements.
+  void pCopyTable(const CompactTable& other) {
+    if (!other.table_) {
+      return;
+    }
+    const auto capacity = other.Capacity();
+    table_ = pAllocateTable(capacity, other.MaxLoadFactor());
+    auto* const headers = pHeaders(pTable());
+    auto* const elements = pElements(pTable(), capacity);
+    const auto* const src_headers = pHeaders(other.pTable());
+    const auto* const src_elements = pElements(other.pTable(), capacity);
+    auto alloc = GetAllocator();
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      if (!src_headers[pos].Empty()) {
+        AllocTraits<Allocator>::construct(alloc, elements + pos,
+                                          src_elements[pos]);
+        headers[pos] = src_headers[pos];
+      }
+    }
+    size_ = other.size_;
+  }
+
+  BytePointer table_{nullptr};
+  SizeType size_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+          typename Alloc>
+bool operator==(const CompactTable<Key, Value, Hash, KeyEqual, Alloc>& lhs,
+                const CompactTable<Key, Value, Hash, KeyEqual, Alloc>& rhs) {
+  using Table = CompactTable<Key, Value, Hash, KeyEqual, Alloc>;
+  return EqualFlatTables(lhs, rhs, [](const auto& key_value) -> decltype(auto) {
+    return Table::pKey(key_value);
+  });
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+          typename Alloc>
+bool operator!=(const CompactTable<Key, Value, Hash, KeyEqual, Alloc>& lhs,
+                const CompactTable<Key, Value, Hash, KeyEqual, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht::prhdtls
@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <functional>
 
@@ -13,12 +17,31 @@
 
 namespace perroht::prhdtls {
 
+/// \brief Deallocates a node on destruction unless released, i.e., if
+/// constructing the data in the node throws.
+template <typename AllocatorType>
+struct NodeGuard {
+  using DataType = typename AllocTraits<AllocatorType>::value_type;
+
+  ~NodeGuard() {
+    if (node) {
+      AllocTraits<AllocatorType>::deallocate(alloc, node, 1);
+    }
+  }
+
+  AllocatorType& alloc;
+  DataType* node;
+};
+
 /// \brief A class to hold an instance of T.
 /// If embed is true, the data is embedded in the class itself.
 /// Otherwise, the data is allocated as an independent node, and this class
 /// holds a pointer to the node. The purpose of this class is to provide the
 /// same interface regardless of the value of embed.
-template <typename T, bool embed, typename Allocator = std::allocator<T>>
+/// If tagged is true and the data is not embedded, the node pointer is packed
+/// into fewer bytes (see the specialization below).
+template <typename T, bool embed, typename Allocator = std::allocator<T>,
+          bool tagged = false>
 class DataHolder {
  public:
   using DataType = T;
@@ -34,6 +57,22 @@ class DataHolder {
     new (ptr) DataHolder(alloc, std::forward<Args>(args)...);
   }
 
+  /// \brief Make a holder that refers to the same data as other without
+  /// modifying other.
+  /// If embed is true, the data is copy constructed.
+  /// Otherwise, only the pointer to the data node is copied; the two holders
+  /// share the node and exactly one of them must be cleared eventually.
+  static DataHolder MakeShallowCopy(AllocatorType& alloc,
+                                    const DataHolder& other) {
+    if constexpr (embed) {
+      return DataHolder(alloc, other.data_);
+    } else {
+      DataHolder holder;
+      holder.data_ = other.data_;
+      return holder;
+    }
+  }
+
   DataHolder() {
     if constexpr (!embed) {
       data_ = nullptr;
@@ -42,6 +81,9 @@ class DataHolder {
 
   /// \brief Constructor.
   /// Construct the data using the given arguments.
+  /// The data is constructed through alloc; thus, if alloc is a
+  /// std::scoped_allocator_adaptor, it is passed to the data
+  /// (uses-allocator construction).
   template <typename... Args>
   DataHolder(AllocatorType& alloc, Args&&... args) {
     if constexpr (embed) {
@@ -53,8 +95,10 @@ class DataHolder {
         assert(false);
         std::abort();
       }
+      NodeGuard<AllocatorType> guard{alloc, ToAddress(data_)};
       AllocTraits<AllocatorType>::construct(alloc, ToAddress(data_),
                                             std::forward<Args>(args)...);
+      guard.node = nullptr;
     }
   }
 
@@ -135,16 +179,156 @@ class DataHolder {
   // To avoid constructing data_, which may not have a default constructor or be
   // expensive to construct, hold the data_ in a union with a dummy variable
   // whose size is the same as data_.
+  using StoredType = typename std::conditional<embed, DataType, Pointer>::type;
   union {
-    std::byte dummy_[sizeof(DataType)];
-    typename std::conditional<embed, DataType, Pointer>::type data_;
+    std::byte dummy_[sizeof(StoredType)];
+    StoredType data_;
   };
 };
 
+/// \brief A DataHolder that holds a node through a raw pointer packed into
+/// the lower kPointerBytes bytes, followed by a one-byte hash fingerprint of
+/// the data's key. Thus, the holder takes 7 bytes, and a one-byte header can
+/// take the eighth byte of an aligned 8-byte word (see TaggedNodeLayout).
+/// The fingerprint is set by the container and moves with the pointer.
+/// \warning Node addresses must fit in kPointerBytes bytes, which is the case
+/// for user-space addresses on x86-64 and AArch64 with 48-bit virtual
+/// addresses; the program aborts otherwise.
+template <typename T, typename Allocator>
+class DataHolder<T, false, Allocator, true> {
+ public:
+  using DataType = T;
+  using AllocatorType = RebindAlloc<Allocator, DataType>;
+  using FingerprintType = uint8_t;
+
+  static_assert(
+      std::is_pointer_v<typename AllocTraits<AllocatorType>::pointer>,
+      "Node pointers can be tagged only if the allocator uses raw pointers");
+
+  template <typename... Args>
+  static constexpr void ConstructInPlace(AllocatorType& alloc,
+                                         DataHolder* const ptr,
+                                         Args&&... args) {
+    new (ptr) DataHolder(alloc, std::forward<Args>(args)...);
+  }
+
+  /// \brief Make a holder that refers to the same node as other.
+  /// Exactly one of the two holders must be cleared eventually.
+  static DataHolder MakeShallowCopy(AllocatorType&, const DataHolder& other) {
+    DataHolder holder;
+    holder.pCopyBytes(other);
+    return holder;
+  }
+
+  DataHolder() { pSetPointer(nullptr, 0); }
+
+  /// \brief Constructor.
+  /// Construct the data in a new node using the given arguments.
+  /// The fingerprint is zero until it is set.
+  template <typename... Args>
+  DataHolder(AllocatorType& alloc, Args&&... args) {
+    DataType* const node = AllocTraits<AllocatorType>::allocate(alloc, 1);
+    if (!node) {
+      assert(false);
+      std::abort();
+    }
+    pSetPointer(node, 0);
+    NodeGuard<AllocatorType> guard{alloc, node};
+    AllocTraits<AllocatorType>::construct(alloc, node,
+                                          std::forward<Args>(args)...);
+    guard.node = nullptr;
+  }
+
+  DataHolder(DataHolder&& other) noexcept {
+    pCopyBytes(other);
+    other.pSetPointer(nullptr, 0);
+  }
+
+  DataHolder(const DataHolder&) = delete;
+  DataHolder& operator=(const DataHolder&) = delete;
+  DataHolder& operator=(DataHolder&& other) noexcept = delete;
+
+  ~DataHolder() noexcept {
+    assert(!pGetPointer());  // safeguard for preventing memory leak
+  }
+
+  void Swap(DataHolder& other) noexcept {
+    using std::swap;
+    swap(bytes_, other.bytes_);
+  }
+
+  /// \brief Destroy the existing node, if any, and take over other's node.
+  inline void MoveAssign(Allocator& alloc, DataHolder&& other) {
+    if (pGetPointer()) {
+      Clear(alloc);
+    }
+    pCopyBytes(other);
+    other.pSetPointer(nullptr, 0);
+  }
+
+  inline DataType& Get() noexcept { return *pGetPointer(); }
+
+  inline const DataType& Get() const noexcept { return *pGetPointer(); }
+
+  inline FingerprintType Fingerprint() const noexcept {
+    return bytes_[kPointerBytes];
+  }
+
+  inline void SetFingerprint(const FingerprintType fingerprint) noexcept {
+    bytes_[kPointerBytes] = fingerprint;
+  }
+
+  void Clear(AllocatorType& alloc) {
+    DataType* const node = pGetPointer();
+    if (!node) return;
+    AllocatorType a(alloc);
+    RebindAllocTraits<AllocatorType, DataType>::destroy(a, node);
+    AllocTraits<AllocatorType>::deallocate(a, node, 1);
+    pSetPointer(nullptr, 0);
+  }
+
+ private:
+  static constexpr int kPointerBytes = 6;
+
+  // The bytes are assembled with shifts so that the pointer is stored in the
+  // same order regardless of the endianness; compilers merge them into a few
+  // wide loads and stores.
+  inline DataType* pGetPointer() const noexcept {
+    std::uintptr_t bits = 0;
+    for (int i = 0; i < kPointerBytes; ++i) {
+      bits |= std::uintptr_t(bytes_[i]) << (8 * i);
+    }
+    return reinterpret_cast<DataType*>(bits);
+  }
+
+  inline void pSetPointer(DataType* const node,
+                          const FingerprintType fingerprint) noexcept {
+    const auto bits = reinterpret_cast<std::uintptr_t>(node);
+    if constexpr (sizeof(bits) > kPointerBytes) {
+      if (bits >> (8 * kPointerBytes)) {
+        assert(false && "The node address does not fit in the tagged pointer");
+        std::abort();
+      }
+    }
+    for (int i = 0; i < kPointerBytes; ++i) {
+      bytes_[i] = uint8_t(bits >> (8 * i));
+    }
+    bytes_[kPointerBytes] = fingerprint;
+  }
+
+  inline void pCopyBytes(const DataHolder& other) noexcept {
+    for (int i = 0; i <= kPointerBytes; ++i) {
+      bytes_[i] = other.bytes_[i];
+    }
+  }
+
+  uint8_t bytes_[kPointerBytes + 1];
+};
+
 /// \brief Swap two DataHolder.
-template <typename T, bool embed, typename Allocator>
-void swap(DataHolder<T, embed, Allocator>& lhs,
-          DataHolder<T, embed, Allocator>& rhs) noexcept {
+template <typename T, bool embed, typename Allocator, bool tagged>
+void swap(DataHolder<T, embed, Allocator, tagged>& lhs,
+          DataHolder<T, embed, Allocator, tagged>& rhs) noexcept {
   lhs.Swap(rhs);
 }
 
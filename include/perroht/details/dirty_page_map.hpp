@@ -0,0 +1,189 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "memory.hpp"
+#include "mmap.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief A memory range.
+struct MemoryRange {
+  std::byte* addr{nullptr};
+  std::size_t length{0};
+};
+
+/// \brief Sort the given ranges and merge the overlapping or adjacent ones.
+inline void CoalesceMemoryRanges(std::vector<MemoryRange>& ranges) {
+  if (ranges.empty()) {
+    return;
+  }
+  std::sort(ranges.begin(), ranges.end(),
+            [](const MemoryRange& lhs, const MemoryRange& rhs) {
+              return lhs.addr < rhs.addr;
+            });
+  std::size_t last = 0;
+  for (std::size_t i = 1; i < ranges.size(); ++i) {
+    auto& prev = ranges[last];
+    const auto& cur = ranges[i];
+    if (cur.addr <= prev.addr + prev.length) {
+      const auto end =
+          std::max(prev.addr + prev.length, cur.addr + cur.length);
+      prev.length = end - prev.addr;
+    } else {
+      ranges[++last] = cur;
+    }
+  }
+  ranges.resize(last + 1);
+}
+
+/// \brief Return the smallest page-aligned range that contains
+/// [addr, addr + length).
+inline MemoryRange PageAlignedRange(const void* const addr,
+                                    const std::size_t length) {
+  const auto begin = reinterpret_cast<uintptr_t>(addr);
+  const auto first = begin - begin % os_page_size();
+  const auto last = begin + length + os_page_size() - 1;
+  return MemoryRange{reinterpret_cast<std::byte*>(first),
+                     std::size_t(last - last % os_page_size() - first)};
+}
+
+/// \brief Flush the given page-aligned ranges to the backing store.
+/// \return True if all ranges were flushed successfully.
+inline bool SyncMemoryRanges(const std::vector<MemoryRange>& ranges) {
+  bool ret = true;
+  for (const auto& range : ranges) {
+    ret &= os_msync(range.addr, range.length);
+  }
+  return ret;
+}
+
+/// \brief A bitmap that records the dirty pages of a memory region.
+/// The bitmap is allocated by the given allocator so that it can be placed
+/// next to the region in a persistent memory segment.
+/// The first word of the bitmap holds the number of pages it covers.
+/// All functions are static; the bitmap is referred to by a pointer returned
+/// from Allocate().
+template <typename ByteAllocator>
+class DirtyPageMap {
+ public:
+  using BytePointer = typename AllocTraits<ByteAllocator>::pointer;
+  using SizeType = std::size_t;
+
+ private:
+  using WordType = uint64_t;
+  static constexpr SizeType kBitsPerWord = sizeof(WordType) * 8;
+
+ public:
+  /// \brief Allocate a bitmap that covers [region, region + length).
+  /// \param dirty If true, all pages are marked dirty initially.
+  static BytePointer Allocate(ByteAllocator& alloc, const std::byte* region,
+                              const SizeType length, const bool dirty) {
+    const auto num_pages = pNumPages(region, length);
+    const auto num_words = pNumWords(num_pages);
+    BytePointer map = AllocTraits<ByteAllocator>::allocate(
+        alloc, (num_words + 1) * sizeof(WordType));
+    if (!map) {
+      return nullptr;
+    }
+    auto* const words = pWords(map);
+    words[0] = num_pages;
+    std::fill(words + 1, words + 1 + num_words,
+              dirty ? ~WordType(0) : WordType(0));
+    if (dirty && num_pages % kBitsPerWord != 0) {
+      // Do not mark pages outside the region.
+      words[num_words] = (WordType(1) << (num_pages % kBitsPerWord)) - 1;
+    }
+    return map;
+  }
+
+  static void Deallocate(ByteAllocator& alloc, BytePointer map) {
+    if (!map) {
+      return;
+    }
+    const auto num_words = pNumWords(pWords(map)[0]);
+    AllocTraits<ByteAllocator>::deallocate(alloc, map,
+                                           (num_words + 1) * sizeof(WordType));
+  }
+
+  /// \brief Mark the pages that overlap [addr, addr + length) dirty.
+  /// addr must be within the region the map covers.
+  static void Mark(BytePointer map, const std::byte* region,
+                   const void* const addr, const SizeType length) {
+    auto* const words = pWords(map);
+    const auto base = pPageBase(region);
+    const auto* const first = static_cast<const std::byte*>(addr);
+    const auto begin_page = SizeType(first - base) / os_page_size();
+    const auto end_page = SizeType(first + length - 1 - base) / os_page_size();
+    assert(end_page < words[0]);
+    for (auto page = begin_page; page <= end_page; ++page) {
+      words[1 + page / kBitsPerWord] |= WordType(1) << (page % kBitsPerWord);
+    }
+  }
+
+  /// \brief Return the number of dirty pages.
+  static SizeType CountDirtyPages(BytePointer map) {
+    const auto* const words = pWords(map);
+    SizeType count = 0;
+    for (SizeType i = 0; i < pNumWords(words[0]); ++i) {
+      count += __builtin_popcountll(words[1 + i]);
+    }
+    return count;
+  }
+
+  /// \brief Return the dirty pages as coalesced ranges and mark them clean.
+  static std::vector<MemoryRange> TakeDirtyRanges(BytePointer map,
+                                                  std::byte* region) {
+    auto* const words = pWords(map);
+    auto* const base = pPageBase(region);
+    std::vector<MemoryRange> ranges;
+    for (SizeType i = 0; i < pNumWords(words[0]); ++i) {
+      auto word = words[1 + i];
+      words[1 + i] = 0;
+      while (word) {
+        const auto bit = SizeType(__builtin_ctzll(word));
+        word &= word - 1;
+        auto* const page = base + (i * kBitsPerWord + bit) * os_page_size();
+        if (!ranges.empty() &&
+            ranges.back().addr + ranges.back().length == page) {
+          ranges.back().length += os_page_size();
+        } else {
+          ranges.push_back(MemoryRange{page, os_page_size()});
+        }
+      }
+    }
+    return ranges;
+  }
+
+ private:
+  static WordType* pWords(BytePointer map) {
+    return reinterpret_cast<WordType*>(ToAddress(map));
+  }
+
+  static std::byte* pPageBase(const std::byte* region) {
+    const auto addr = reinterpret_cast<uintptr_t>(region);
+    return reinterpret_cast<std::byte*>(addr - addr % os_page_size());
+  }
+
+  static SizeType pNumPages(const std::byte* region, const SizeType length) {
+    const auto end = reinterpret_cast<uintptr_t>(region + length);
+    const auto base = reinterpret_cast<uintptr_t>(pPageBase(region));
+    return (end - base + os_page_size() - 1) / os_page_size();
+  }
+
+  static SizeType pNumWords(const SizeType num_pages) {
+    return (num_pages + kBitsPerWord - 1) / kBitsPerWord;
+  }
+};
+
+}  // namespace perroht::prhdtls
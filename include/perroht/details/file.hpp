@@ -0,0 +1,63 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace perroht::prhdtls {
+
+/// \brief A simple wrapper for write(2) that writes all bytes.
+/// Retries if write(2) is interrupted or writes only a part of the buffer.
+inline bool os_write(const int fd, const void *const buf, const size_t size) {
+  const auto *p = static_cast<const char *>(buf);
+  std::size_t remaining = size;
+  while (remaining > 0) {
+    const auto ret = ::write(fd, p, remaining);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    p += ret;
+    remaining -= std::size_t(ret);
+  }
+  return true;
+}
+
+/// \brief A simple wrapper for read(2) that reads up to size bytes.
+/// \return The number of bytes read, or -1 on error.
+inline ssize_t os_read(const int fd, void *const buf, const size_t size) {
+  auto *p = static_cast<char *>(buf);
+  std::size_t total = 0;
+  while (total < size) {
+    const auto ret = ::read(fd, p + total, size - total);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    if (ret == 0) break;  // EOF
+    total += std::size_t(ret);
+  }
+  return ssize_t(total);
+}
+
+/// \brief A simple wrapper for fsync(2).
+inline bool os_fsync(const int fd) { return ::fsync(fd) == 0; }
+
+/// \brief Flush the directory entry of the given directory.
+inline bool os_fsync_directory(const char *const path) {
+  const int fd = ::open(path, O_RDONLY | O_DIRECTORY);
+  if (fd == -1) return false;
+  const bool ret = os_fsync(fd);
+  ::close(fd);
+  return ret;
+}
+
+}  // namespace perroht::prhdtls
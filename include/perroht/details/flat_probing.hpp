@@ -0,0 +1,264 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace perroht::prhdtls {
+
+/// \brief The capacity policy of the flat tables (IntFlatTable,
+/// CompactTable, and StringFlatTable).
+/// Capacities are powers of two, starting from kMinCapacity, and a table
+/// always has at least one empty position, which ends every probe.
+struct FlatCapacity {
+  using SizeType = std::size_t;
+
+  static constexpr SizeType kMinCapacity = 8;
+
+  static constexpr float CleanseMaxLoadFactor(const float max_load_factor) {
+    return std::max(std::numeric_limits<float>::epsilon() * 100.0f,
+                    std::min(max_load_factor, 1.0f));
+  }
+
+  static bool Enough(const SizeType n, const SizeType capacity,
+                     const float max_load_factor) {
+    return n == 0 ||
+           (n < capacity && float(n) <= float(capacity) * max_load_factor);
+  }
+
+  /// Return the smallest capacity that holds n elements.
+  static SizeType Next(const SizeType n, const float max_load_factor) {
+    if (n == 0) {
+      return 0;
+    }
+    SizeType capacity = kMinCapacity;
+    while (!Enough(n, capacity, max_load_factor)) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  /// Return the capacity to rebuild a table of n elements with when at least
+  /// the requested number of positions is asked for.
+  static SizeType ForRehash(const SizeType n, const SizeType request,
+                            const float max_load_factor) {
+    auto capacity = Next(n, max_load_factor);
+    if (capacity == 0 && request > 0) {
+      capacity = kMinCapacity;
+    }
+    while (capacity < request) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+};
+
+/// \brief Robin Hood probing over a power-of-two array of positions.
+/// The flat tables differ in how a position tells that it is empty and how
+/// far its element is from its ideal position: a reserved key, a header, or
+/// a stored hash value. A table describes its positions with a Slots object
+/// that provides the following; the functions are const as the object only
+/// refers to the table.
+///   SizeType Capacity();
+///   bool Empty(SizeType pos);
+///   SizeType IdealPosition(const Element& element);
+///   SizeType ProbeDistance(SizeType pos);  // Of the element at pos
+///   void Put(SizeType pos, Element&& element, SizeType dist);  // pos is empty
+///   void Exchange(SizeType pos, Element& element, SizeType dist);
+///   void Shift(SizeType dst, SizeType src, SizeType dist);  // src to dst
+///   void MakeEmpty(SizeType pos);
+/// dist is the probe distance of the element at its new position.
+class FlatProbing {
+ public:
+  using SizeType = std::size_t;
+
+  /// Return the position of the element for which match(pos) is true,
+  /// probing from the ideal position of the key, or the capacity if there
+  /// is none. The capacity must not be 0.
+  template <typename Slots, typename Match>
+  static SizeType Locate(const Slots& slots, SizeType pos, Match&& match) {
+    const auto mask = slots.Capacity() - 1;
+    for (SizeType dist = 0;; ++dist) {
+      if (slots.Empty(pos)) {
+        return slots.Capacity();
+      }
+      if (match(pos)) {
+        return pos;
+      }
+      // The key would have displaced an element that is closer to its
+      // ideal position.
+      if (slots.ProbeDistance(pos) < dist) {
+        return slots.Capacity();
+      }
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  /// Place a new element, swapping it with each element that is closer to
+  /// its ideal position than the one being placed, and return the position
+  /// of the new element. The table must have an empty position.
+  template <typename Slots, typename Element>
+  static SizeType Place(const Slots& slots, Element&& element) {
+    const auto capacity = slots.Capacity();
+    const auto mask = capacity - 1;
+    auto pos = slots.IdealPosition(element);
+    auto placed = capacity;
+    for (SizeType dist = 0;; ++dist) {
+      if (slots.Empty(pos)) {
+        slots.Put(pos, std::move(element), dist);
+        return placed == capacity ? pos : placed;
+      }
+      const auto slot_dist = slots.ProbeDistance(pos);
+      if (slot_dist < dist) {
+        slots.Exchange(pos, element, dist);
+        if (placed == capacity) {
+          placed = pos;
+        }
+        dist = slot_dist;
+      }
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  /// Erase the element at pos with backward shifting: the following
+  /// elements move back by one position until an empty position or an
+  /// element at its ideal position is found.
+  template <typename Slots>
+  static void Erase(const Slots& slots, SizeType pos) {
+    const auto mask = slots.Capacity() - 1;
+    for (auto next = (pos + 1) & mask; !slots.Empty(next);
+         next = (next + 1) & mask) {
+      const auto dist = slots.ProbeDistance(next);
+      if (dist == 0) {
+        break;
+      }
+      slots.Shift(pos, next, dist - 1);
+      pos = next;
+    }
+    slots.MakeEmpty(pos);
+  }
+
+  /// Return the first position at or after pos that is not empty, or the
+  /// capacity.
+  template <typename Slots>
+  static SizeType FirstOccupied(const Slots& slots, SizeType pos) {
+    for (; pos < slots.Capacity(); ++pos) {
+      if (!slots.Empty(pos)) {
+        return pos;
+      }
+    }
+    return slots.Capacity();
+  }
+};
+
+/// \brief Holds the proxy object returned by FlatIterator::operator->() if
+/// the elements are not stored as objects.
+template <typename Reference>
+class ArrowProxy {
+ public:
+  explicit ArrowProxy(Reference ref) : ref_(std::move(ref)) {}
+
+  Reference* operator->() { return &ref_; }
+
+ private:
+  Reference ref_;
+};
+
+/// \brief A forward iterator over the elements of a flat table.
+/// Table provides ElementType, the value type; pElementAt(pos), which
+/// returns a reference to the element at pos or a proxy pair; and
+/// pNextPosition(pos), which returns the position of the element that
+/// follows the one at pos or the end position.
+template <typename Table, bool IsConst>
+class FlatIterator {
+ private:
+  using SizeType = std::size_t;
+  using ContainerPointer =
+      std::conditional_t<IsConst, const Table*, Table*>;
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename Table::ElementType;
+  using difference_type = std::ptrdiff_t;
+  using reference =
+      decltype(std::declval<ContainerPointer>()->pElementAt(SizeType()));
+  using pointer =
+      std::conditional_t<std::is_reference_v<reference>,
+                         std::remove_reference_t<reference>*,
+                         ArrowProxy<reference>>;
+
+  FlatIterator() = default;
+
+  /// pos must hold an element or be the end position.
+  FlatIterator(const SizeType pos, ContainerPointer container)
+      : pos_(pos), container_(container) {
+    assert(container_);
+  }
+
+  /// Conversion from a non-const iterator.
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  FlatIterator(const FlatIterator<Table, false>& other)
+      : pos_(other.Position()), container_(other.Container()) {}
+
+  FlatIterator& operator++() {
+    pos_ = container_->pNextPosition(pos_);
+    return *this;
+  }
+
+  FlatIterator operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  reference operator*() const { return container_->pElementAt(pos_); }
+
+  pointer operator->() const {
+    if constexpr (std::is_reference_v<reference>) {
+      return &**this;
+    } else {
+      return pointer(**this);
+    }
+  }
+
+  bool operator==(const FlatIterator& other) const {
+    return container_ == other.container_ && pos_ == other.pos_;
+  }
+
+  bool operator!=(const FlatIterator& other) const { return !(*this == other); }
+
+  SizeType Position() const { return pos_; }
+
+  ContainerPointer Container() const { return container_; }
+
+ private:
+  SizeType pos_{0};
+  ContainerPointer container_{nullptr};
+};
+
+/// \brief Return true if two flat tables hold the same elements.
+/// get_key returns the key of an element given by an iterator.
+template <typename Table, typename GetKey>
+bool EqualFlatTables(const Table& lhs, const Table& rhs, GetKey&& get_key) {
+  if (lhs.Size() != rhs.Size()) {
+    return false;
+  }
+  for (auto it = lhs.Begin(); it != lhs.End(); ++it) {
+    const auto found = rhs.Find(get_key(*it));
+    if (found == rhs.End() || !(*found == *it)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,569 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "flat_probing.hpp"
+#include "key_value_traits.hpp"
+#include "memory.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief A Robin Hood hash table for integer keys without headers.
+/// The table is an array of elements only. The largest key value marks an
+/// empty position; an element with that key is kept in a side slot inside
+/// the container object instead of in the table. Probe distances are
+/// computed from the hash values of the keys on demand, which is cheap for
+/// integer keys. Probing is done by FlatProbing.
+/// table_ is an allocator pointer, e.g., an offset pointer of mmap_allocator.
+/// Empty positions hold the empty key and a value-initialized value; thus,
+/// values must be default constructible.
+template <typename Key, typename Value, typename Hash, typename Alloc>
+class IntFlatTable {
+ private:
+  using KVTraits = KeyValueTraits<Key, Value, true>;
+  static_assert(std::is_integral_v<Key>, "Keys must be integers");
+
+ public:
+  using KeyType = typename KVTraits::KeyType;
+  using ValueType = typename KVTraits::ValueType;
+  using KeyValueType = typename KVTraits::KeyValueType;
+  using Hasher = Hash;
+  using SizeType = std::size_t;
+  using DifferentType = std::ptrdiff_t;
+  using Allocator = RebindAlloc<Alloc, KeyValueType>;
+
+ private:
+  using SelfType = IntFlatTable<Key, Value, Hash, Alloc>;
+  using Pointer = typename AllocTraits<Allocator>::pointer;
+  using ElementType = KeyValueType;
+  friend class FlatIterator<SelfType, false>;
+  friend class FlatIterator<SelfType, true>;
+
+ public:
+  /// Visits the positions of the table in order, then the side slot.
+  template <bool IsConst>
+  using BaseIterator = FlatIterator<SelfType, IsConst>;
+  using Iterator = BaseIterator<false>;
+  using ConstIterator = BaseIterator<true>;
+
+  /// The key value that marks an empty position.
+  static constexpr KeyType kEmptyKey = std::numeric_limits<KeyType>::max();
+
+  explicit IntFlatTable(const SizeType capacity = 0,
+                        const float max_load_factor = 0.875,
+                        const Hasher& hash = Hasher(),
+                        const Allocator& alloc = Allocator())
+      : max_load_factor_(FlatCapacity::CleanseMaxLoadFactor(max_load_factor)),
+        allocator_(alloc),
+        hasher_(hash) {
+    Reserve(capacity);
+  }
+
+  IntFlatTable(const IntFlatTable& other)
+      : IntFlatTable(other,
+                     AllocTraits<Allocator>::
+                         select_on_container_copy_construction(
+                             other.allocator_)) {}
+
+  IntFlatTable(const IntFlatTable& other, const Allocator& alloc)
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(alloc),
+        hasher_(other.hasher_),
+        side_(other.side_),
+        has_side_(other.has_side_) {
+    pCopyTable(other);
+  }
+
+  IntFlatTable(IntFlatTable&& other) noexcept
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(std::move(other.allocator_)),
+        hasher_(std::move(other.hasher_)),
+        side_(std::move(other.side_)),
+        has_side_(other.has_side_),
+        size_(other.size_),
+        capacity_(other.capacity_),
+        table_(std::move(other.table_)) {
+    other.pForgetTable();
+  }
+
+  IntFlatTable(IntFlatTable&& other, const Allocator& alloc)
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(alloc),
+        hasher_(other.hasher_),
+        side_(std::move(other.side_)),
+        has_side_(other.has_side_) {
+    if (allocator_ == other.allocator_) {
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    } else {
+      pCopyTable(other);
+    }
+  }
+
+  ~IntFlatTable() noexcept { pDestroyTable(); }
+
+  IntFlatTable& operator=(const IntFlatTable& other) {
+    if (this != &other) {
+      IntFlatTable tmp(other, allocator_);
+      Swap(tmp);
+    }
+    return *this;
+  }
+
+  IntFlatTable& operator=(IntFlatTable&& other) noexcept {
+    if (this != &other) {
+      pDestroyTable();
+      max_load_factor_ = other.max_load_factor_;
+      allocator_ = std::move(other.allocator_);
+      hasher_ = std::move(other.hasher_);
+      side_ = std::move(other.side_);
+      has_side_ = other.has_side_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    }
+    return *this;
+  }
+
+  Allocator GetAllocator() const { return allocator_; }
+
+  Hasher GetHashFunction() const { return hasher_; }
+
+  // ----- Iterators ----- //
+  // The positions of the table are visited in order, then the side slot.
+
+  Iterator Begin() { return Iterator(pFirstPosition(0), this); }
+
+  ConstIterator Begin() const {
+    return ConstIterator(pFirstPosition(0), this);
+  }
+
+  Iterator End() { return Iterator(pEndPosition(), this); }
+
+  ConstIterator End() const { return ConstIterator(pEndPosition(), this); }
+
+  // ----- Capacity ----- //
+
+  SizeType Size() const { return size_ + (has_side_ ? 1 : 0); }
+
+  bool Empty() const { return Size() == 0; }
+
+  SizeType MaxSize() const noexcept {
+    return AllocTraits<Allocator>::max_size(allocator_);
+  }
+
+  /// \brief Return the number of positions in the table, excluding the side
+  /// slot.
+  SizeType Capacity() const { return capacity_; }
+
+  // ----- Modifiers ----- //
+
+  void Clear() noexcept {
+    for (SizeType pos = 0; pos < capacity_; ++pos) {
+      if (!pEmptyAt(pos)) {
+        pMakeEmpty(pos);
+      }
+    }
+    size_ = 0;
+    pClearSide();
+  }
+
+  /// \brief Insert an element constructed from args if there is no element
+  /// with the key.
+  template <typename... Args>
+  std::pair<Iterator, bool> TryEmplace(const KeyType& key, Args&&... args) {
+    if (key == kEmptyKey) {
+      if (has_side_) {
+        return {Iterator(capacity_, this), false};
+      }
+      pAssign(side_, pMakeElement(key, std::forward<Args>(args)...));
+      has_side_ = true;
+      return {Iterator(capacity_, this), true};
+    }
+
+    if (const auto pos = pLocate(key); pos != capacity_) {
+      return {Iterator(pos, this), false};
+    }
+    if (!pEnoughCapacity(size_ + 1, capacity_)) {
+      pRehash(pNextCapacity(size_ + 1));
+    }
+    const auto pos =
+        FlatProbing::Place(pSlots(table_, capacity_),
+                           pMakeElement(key, std::forward<Args>(args)...));
+    ++size_;
+    return {Iterator(pos, this), true};
+  }
+
+  std::pair<Iterator, bool> Insert(const KeyValueType& key_value) {
+    KeyValueType copy(key_value);
+    return Insert(std::move(copy));
+  }
+
+  std::pair<Iterator, bool> Insert(KeyValueType&& key_value) {
+    if constexpr (std::is_same_v<ValueType, VoidValue>) {
+      return TryEmplace(key_value);
+    } else {
+      return TryEmplace(key_value.first, std::move(key_value.second));
+    }
+  }
+
+  template <typename... Args>
+  std::pair<Iterator, bool> Emplace(Args&&... args) {
+    KeyValueType key_value(std::forward<Args>(args)...);
+    return Insert(std::move(key_value));
+  }
+
+  SizeType Erase(const KeyType& key) {
+    const auto pos = pFind(key);
+    if (pos == pEndPosition()) {
+      return 0;
+    }
+    pEraseAt(pos);
+    return 1;
+  }
+
+  /// \brief Erase the element at the given position.
+  /// \return An iterator to the element that follows the erased one.
+  Iterator Erase(const ConstIterator it) {
+    const auto pos = it.Position();
+    if (pos == pEndPosition()) {
+      return End();
+    }
+    pEraseAt(pos);
+    // Backward shifting may have moved the next element into pos.
+    return Iterator(pos == capacity_ ? pEndPosition() : pFirstPosition(pos),
+                    this);
+  }
+
+  void Swap(IntFlatTable& other) noexcept {
+    using std::swap;
+    if constexpr (AllocTraits<
+                      Allocator>::propagate_on_container_swap::value) {
+      swap(allocator_, other.allocator_);
+    }
+    swap(max_load_factor_, other.max_load_factor_);
+    swap(hasher_, other.hasher_);
+    swap(side_, other.side_);
+    swap(has_side_, other.has_side_);
+    swap(size_, other.size_);
+    swap(capacity_, other.capacity_);
+    swap(table_, other.table_);
+  }
+
+  // ----- Lookup ----- //
+
+  Iterator Find(const KeyType& key) { return Iterator(pFind(key), this); }
+
+  ConstIterator Find(const KeyType& key) const {
+    return ConstIterator(pFind(key), this);
+  }
+
+  SizeType Count(const KeyType& key) const { return Contains(key) ? 1 : 0; }
+
+  bool Contains(const KeyType& key) const {
+    return pFind(key) != pEndPosition();
+  }
+
+  // ----- Hash Policy ----- //
+
+  float LoadFactor() const {
+    return capacity_ == 0 ? 0.0f : float(size_) / float(capacity_);
+  }
+
+  float MaxLoadFactor() const { return max_load_factor_; }
+
+  void MaxLoadFactor(const float max_load_factor) {
+    max_load_factor_ = FlatCapacity::CleanseMaxLoadFactor(max_load_factor);
+    Reserve(Size());
+  }
+
+  /// \brief Make the table large enough to hold n elements without growing.
+  void Reserve(const SizeType n) {
+    if (!pEnoughCapacity(n, capacity_)) {
+      pRehash(pNextCapacity(n));
+    }
+  }
+
+  /// \brief Rebuild the table with at least the given number of positions,
+  /// or the smallest capacity that holds the current elements, whichever is
+  /// larger.
+  void Rehash(const SizeType capacity) {
+    const auto new_capacity =
+        FlatCapacity::ForRehash(size_, capacity, max_load_factor_);
+    if (new_capacity != capacity_) {
+      pRehash(new_capacity);
+    }
+  }
+
+  template <typename K, typename V, typename H, typename A>
+  friend bool operator==(const IntFlatTable<K, V, H, A>& lhs,
+                         const IntFlatTable<K, V, H, A>& rhs);
+
+ private:
+  /// The positions of a table for FlatProbing.
+  struct Slots {
+    KeyValueType* table;
+    SizeType capacity;
+    const Hasher& hasher;
+
+    SizeType Capacity() const { return capacity; }
+
+    bool Empty(const SizeType pos) const {
+      return pKey(table[pos]) == kEmptyKey;
+    }
+
+    SizeType IdealPosition(const KeyValueType& key_value) const {
+      return hasher(pKey(key_value)) & (capacity - 1);
+    }
+
+    SizeType ProbeDistance(const SizeType pos) const {
+      return (pos - IdealPosition(table[pos])) & (capacity - 1);
+    }
+
+    void Put(const SizeType pos, KeyValueType&& key_value,
+             SizeType) const {
+      pAssign(table[pos], std::move(key_value));
+    }
+
+    void Exchange(const SizeType pos, KeyValueType& key_value,
+                  SizeType) const {
+      using std::swap;
+      swap(table[pos], key_value);
+    }
+
+    void Shift(const SizeType dst, const SizeType src, SizeType) const {
+      pAssign(table[dst], std::move(table[src]));
+    }
+
+    void MakeEmpty(const SizeType pos) const {
+      pAssign(table[pos], pMakeElement(kEmptyKey));
+    }
+  };
+
+  static const KeyType& pKey(const KeyValueType& key_value) {
+    return KVTraits::GetKey(key_value);
+  }
+
+  Slots pSlots(const Pointer& table, const SizeType capacity) const {
+    return Slots{ToAddress(table), capacity, hasher_};
+  }
+
+  bool pEnoughCapacity(const SizeType n, const SizeType capacity) const {
+    return FlatCapacity::Enough(n, capacity, max_load_factor_);
+  }
+
+  SizeType pNextCapacity(const SizeType n) const {
+    return FlatCapacity::Next(n, max_load_factor_);
+  }
+
+  SizeType pEndPosition() const { return capacity_ + 1; }
+
+  /// Return the first position at or after pos that holds an element, where
+  /// capacity_ is the side slot, or the end position.
+  SizeType pFirstPosition(const SizeType pos) const {
+    const auto found = FlatProbing::FirstOccupied(pSlots(table_, capacity_),
+                                                  pos);
+    if (found < capacity_) {
+      return found;
+    }
+    return has_side_ ? capacity_ : pEndPosition();
+  }
+
+  SizeType pNextPosition(const SizeType pos) const {
+    return pos < capacity_ ? pFirstPosition(pos + 1) : pEndPosition();
+  }
+
+  KeyValueType& pElementAt(const SizeType pos) {
+    return pos == capacity_ ? side_ : ToAddress(table_)[pos];
+  }
+
+  const KeyValueType& pElementAt(const SizeType pos) const {
+    return pos == capacity_ ? side_ : ToAddress(table_)[pos];
+  }
+
+  bool pEmptyAt(const SizeType pos) const {
+    return pKey(ToAddress(table_)[pos]) == kEmptyKey;
+  }
+
+  /// Locate the element with the key in the table.
+  /// Return capacity_ if it is not found.
+  SizeType pLocate(const KeyType& key) const {
+    if (capacity_ == 0) {
+      return capacity_;
+    }
+    const auto slots = pSlots(table_, capacity_);
+    return FlatProbing::Locate(
+        slots, hasher_(key) & (capacity_ - 1),
+        [&](const SizeType pos) { return pKey(slots.table[pos]) == key; });
+  }
+
+  /// Find the element with the key, including the side slot.
+  /// Return the end position if it is not found.
+  SizeType pFind(const KeyType& key) const {
+    if (key == kEmptyKey) {
+      return has_side_ ? capacity_ : pEndPosition();
+    }
+    const auto pos = pLocate(key);
+    return pos == capacity_ ? pEndPosition() : pos;
+  }
+
+  /// Erase the element at the given position, where capacity_ is the side
+  /// slot.
+  void pEraseAt(const SizeType pos) {
+    if (pos == capacity_) {
+      pClearSide();
+      return;
+    }
+    FlatProbing::Erase(pSlots(table_, capacity_), pos);
+    --size_;
+  }
+
+  template <typename... Args>
+  static KeyValueType pMakeElement(const KeyType& key, Args&&... args) {
+    if constexpr (std::is_same_v<ValueType, VoidValue>) {
+      static_assert(sizeof...(Args) == 0);
+      return key;
+    } else {
+      return KeyValueType(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+  }
+
+  static void pAssign(KeyValueType& slot, KeyValueType&& key_value) {
+    slot = std::move(key_value);
+  }
+
+  void pMakeEmpty(const SizeType pos) {
+    pAssign(ToAddress(table_)[pos], pMakeElement(kEmptyKey));
+  }
+
+  void pClearSide() {
+    if (has_side_) {
+      pAssign(side_, pMakeElement(kEmptyKey));
+      has_side_ = false;
+    }
+  }
+
+  Pointer pAllocateTable(const SizeType capacity) {
+    auto table = AllocTraits<Allocator>::allocate(allocator_, capacity);
+    if (!table) {
+      assert(false);
+      std::abort();
+    }
+    auto* const raw = ToAddress(table);
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      if constexpr (std::is_same_v<ValueType, VoidValue>) {
+        AllocTraits<Allocator>::construct(allocator_, raw + pos, kEmptyKey);
+      } else {
+        AllocTraits<Allocator>::construct(
+            allocator_, raw + pos, std::piecewise_construct,
+            std::forward_as_tuple(kEmptyKey), std::forward_as_tuple());
+      }
+    }
+    return table;
+  }
+
+  void pDeallocateTable(Pointer table, const SizeType capacity) {
+    if (!table) {
+      return;
+    }
+    auto* const raw = ToAddress(table);
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      AllocTraits<Allocator>::destroy(allocator_, raw + pos);
+    }
+    AllocTraits<Allocator>::deallocate(allocator_, table, capacity);
+  }
+
+  void pDestroyTable() {
+    pDeallocateTable(table_, capacity_);
+    pForgetTable();
+  }
+
+  void pForgetTable() {
+    table_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    has_side_ = false;
+  }
+
+  /// Move the elements to a new table of the given capacity.
+  void pRehash(const SizeType new_capacity) {
+    assert(pEnoughCapacity(size_, new_capacity));
+    Pointer new_table = nullptr;
+    if (new_capacity > 0) {
+      new_table = pAllocateTable(new_capacity);
+      auto* const table = ToAddress(table_);
+      for (SizeType pos = 0; pos < capacity_; ++pos) {
+        if (pKey(table[pos]) != kEmptyKey) {
+          FlatProbing::Place(pSlots(new_table, new_capacity),
+                             std::move(table[pos]));
+        }
+      }
+    }
+    pDeallocateTable(table_, capacity_);
+    table_ = new_table;
+    capacity_ = new_capacity;
+  }
+
+  /// Copy the table of other, keeping the positions of the elements.
+  void pCopyTable(const IntFlatTable& other) {
+    if (other.capacity_ == 0) {
+      return;
+    }
+    table_ = AllocTraits<Allocator>::allocate(allocator_, other.capacity_);
+    if (!table_) {
+      assert(false);
+      std::abort();
+    }
+    auto* const dst = ToAddress(table_);
+    const auto* const src = ToAddress(other.table_);
+    for (SizeType pos = 0; pos < other.capacity_; ++pos) {
+      AllocTraits<Allocator>::construct(allocator_, dst + pos, src[pos]);
+    }
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+  }
+
+  float max_load_factor_{0.875};
+  Allocator allocator_{};
+  Hasher hasher_{};
+  KeyValueType side_{pMakeElement(kEmptyKey)};
+  bool has_side_{false};
+  SizeType size_{0};  // The number of elements in the table.
+  SizeType capacity_{0};
+  Pointer table_{nullptr};
+};
+
+template <typename Key, typename Value, typename Hash, typename Alloc>
+bool operator==(const IntFlatTable<Key, Value, Hash, Alloc>& lhs,
+                const IntFlatTable<Key, Value, Hash, Alloc>& rhs) {
+  using Table = IntFlatTable<Key, Value, Hash, Alloc>;
+  return EqualFlatTables(lhs, rhs, [](const auto& key_value) -> decltype(auto) {
+    return Table::pKey(key_value);
+  });
+}
+
+template <typename Key, typename Value, typename Hash, typename Alloc>
+bool operator!=(const IntFlatTable<Key, Value, Hash, Alloc>& lhs,
+                const IntFlatTable<Key, Value, Hash, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,248 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+#include "type_traits.hpp"
+
+// Table layout policies.
+// A layout decides where the header, the data holder, and the copy of the key
+// (if any) of each position are placed in the single allocation of a table.
+// Each policy provides kTaggedNode, which is true if node pointers are to be
+// packed with a hash fingerprint into 7-byte data holders (only done for
+// node containers with raw pointers), and a class template,
+// Offsets<Header, Key, DataHolder>, with the following members:
+//  kSeparateHeader: true if the headers form an array of their own, followed
+//    by the other arrays; the offsets of the data depend on the capacity.
+//  kKeyArray: true if a copy of the key of each entry is kept in a key array.
+//  kGroupSize: the number of positions whose headers and data are stored in
+//    a block; the memory of a table can be given back block by block only.
+//  MemorySize(capacity): the size of a table in bytes.
+//  HeaderOffset(pos), DataOffset(capacity, pos), and KeyOffset(capacity,
+//    pos): the offsets of the elements of a position in a table.
+
+namespace perroht {
+
+/// \brief Each header is followed by its data: [H][D][H][D]...
+/// A probe touches a single cache line in most cases; however, the data
+/// holders are not aligned.
+struct InterleavedLayout {
+  static constexpr bool kTaggedNode = false;
+
+  template <typename Header, typename Key, typename DataHolder>
+  class Offsets {
+   public:
+    using SizeType = std::size_t;
+
+    static constexpr bool kSeparateHeader = false;
+    static constexpr bool kKeyArray = false;
+    static constexpr SizeType kGroupSize = 1;
+
+    static constexpr SizeType MemorySize(const SizeType capacity) {
+      return (sizeof(Header) + sizeof(DataHolder)) * capacity;
+    }
+
+    static constexpr SizeType HeaderOffset(const SizeType pos) {
+      return MemorySize(pos);
+    }
+
+    static constexpr SizeType DataOffset(const SizeType, const SizeType pos) {
+      return MemorySize(pos) + sizeof(Header);
+    }
+
+    static constexpr SizeType KeyOffset(const SizeType, const SizeType) {
+      return 0;
+    }
+  };
+};
+
+/// \brief The headers are stored in an array followed by the data array:
+/// [H][H]...[D][D]...
+/// Probing the headers does not touch the data.
+struct SeparateHeaderLayout {
+  static constexpr bool kTaggedNode = false;
+
+  template <typename Header, typename Key, typename DataHolder>
+  class Offsets {
+   public:
+    using SizeType = std::size_t;
+
+    static constexpr bool kSeparateHeader = true;
+    static constexpr bool kKeyArray = false;
+    static constexpr SizeType kGroupSize = 1;
+
+    static constexpr SizeType MemorySize(const SizeType capacity) {
+      return (sizeof(Header) + sizeof(DataHolder)) * capacity;
+    }
+
+    static constexpr SizeType HeaderOffset(const SizeType pos) {
+      return pos * sizeof(Header);
+    }
+
+    static constexpr SizeType DataOffset(const SizeType capacity,
+                                         const SizeType pos) {
+      return capacity * sizeof(Header) + pos * sizeof(DataHolder);
+    }
+
+    static constexpr SizeType KeyOffset(const SizeType, const SizeType) {
+      return 0;
+    }
+  };
+};
+
+/// \brief Same as SeparateHeaderLayout, plus a copy of the key of each entry
+/// in an array between the header array and the data array:
+/// [H][H]...[K][K]...[D][D]...
+/// Probes touch the headers and keys only; the data is read on a hit only.
+/// Keys must be trivially copyable as they are copied and overwritten without
+/// being destroyed; otherwise, this layout is the same as
+/// SeparateHeaderLayout.
+struct SeparateKeyLayout {
+  static constexpr bool kTaggedNode = false;
+
+  template <typename Header, typename Key, typename DataHolder>
+  class Offsets {
+   public:
+    using SizeType = std::size_t;
+
+    static constexpr bool kSeparateHeader = true;
+    static constexpr bool kKeyArray = prhdtls::IsBitwiseCopyableV<Key>;
+    static constexpr SizeType kGroupSize = 1;
+
+    static constexpr SizeType MemorySize(const SizeType capacity) {
+      return (sizeof(Header) + kKeySize + sizeof(DataHolder)) * capacity;
+    }
+
+    static constexpr SizeType HeaderOffset(const SizeType pos) {
+      return pos * sizeof(Header);
+    }
+
+    static constexpr SizeType DataOffset(const SizeType capacity,
+                                         const SizeType pos) {
+      return KeyOffset(capacity, capacity) + pos * sizeof(DataHolder);
+    }
+
+    static constexpr SizeType KeyOffset(const SizeType capacity,
+                                        const SizeType pos) {
+      return capacity * sizeof(Header) + pos * kKeySize;
+    }
+
+   private:
+    static constexpr SizeType kKeySize = kKeyArray ? sizeof(Key) : 0;
+  };
+};
+
+/// \brief The headers of kGroupSize consecutive positions are stored
+/// together, followed by their data, in a block:
+/// [H x 8][D x 8][H x 8][D x 8]...
+/// The data of a block starts at an offset aligned for the data holder; thus,
+/// unlike InterleavedLayout, no data holder is misaligned with respect to the
+/// table. Probing a few positions usually stays within the header line of a
+/// block; a small group keeps the data close to it.
+struct GroupedHeaderLayout {
+  static constexpr bool kTaggedNode = false;
+
+  template <typename Header, typename Key, typename DataHolder>
+  class Offsets {
+   public:
+    using SizeType = std::size_t;
+
+    static constexpr bool kSeparateHeader = false;
+    static constexpr bool kKeyArray = false;
+    static constexpr SizeType kGroupSize = 8;
+
+    /// The last block is allocated in full, even if it is partially used.
+    static constexpr SizeType MemorySize(const SizeType capacity) {
+      return (capacity + kGroupSize - 1) / kGroupSize * kBlockSize;
+    }
+
+    static constexpr SizeType HeaderOffset(const SizeType pos) {
+      return pos / kGroupSize * kBlockSize + pos % kGroupSize * sizeof(Header);
+    }
+
+    static constexpr SizeType DataOffset(const SizeType, const SizeType pos) {
+      return pos / kGroupSize * kBlockSize + kBlockHeaderSize +
+             pos % kGroupSize * sizeof(DataHolder);
+    }
+
+    static constexpr SizeType KeyOffset(const SizeType, const SizeType) {
+      return 0;
+    }
+
+   private:
+    static constexpr SizeType kBlockHeaderSize =
+        (kGroupSize * sizeof(Header) + alignof(DataHolder) - 1) /
+        alignof(DataHolder) * alignof(DataHolder);
+    static constexpr SizeType kBlockSize =
+        kBlockHeaderSize + kGroupSize * sizeof(DataHolder);
+  };
+};
+
+/// \brief For node containers whose allocator uses raw pointers, each
+/// position is an aligned 8-byte word: the node pointer packed into 6 bytes,
+/// a one-byte hash fingerprint of the key, and the header in the top byte:
+/// [D|H][D|H]...
+/// A probe reads one aligned word per position and dereferences a node only
+/// if the fingerprints match. Containers with embedded elements or fancy
+/// pointers, e.g., offset pointers of persistent allocators, keep full data
+/// holders; for them, this layout is the same as InterleavedLayout but with
+/// the header after the data.
+struct TaggedNodeLayout {
+  static constexpr bool kTaggedNode = true;
+
+  template <typename Header, typename Key, typename DataHolder>
+  class Offsets {
+   public:
+    using SizeType = std::size_t;
+
+    static constexpr bool kSeparateHeader = false;
+    static constexpr bool kKeyArray = false;
+    static constexpr SizeType kGroupSize = 1;
+
+    static constexpr SizeType MemorySize(const SizeType capacity) {
+      return (sizeof(DataHolder) + sizeof(Header)) * capacity;
+    }
+
+    static constexpr SizeType HeaderOffset(const SizeType pos) {
+      return MemorySize(pos) + sizeof(DataHolder);
+    }
+
+    static constexpr SizeType DataOffset(const SizeType, const SizeType pos) {
+      return MemorySize(pos);
+    }
+
+    static constexpr SizeType KeyOffset(const SizeType, const SizeType) {
+      return 0;
+    }
+  };
+};
+
+// The default layout can be chosen at compile time with a macro.
+#if defined(PERROHT_GROUPED_HEADER) && \
+    (defined(PERROHT_SEPARATE_HEADER) || defined(PERROHT_SEPARATE_KEY))
+#error "PERROHT_GROUPED_HEADER cannot be combined with PERROHT_SEPARATE_HEADER"
+#endif
+#if defined(PERROHT_TAGGED_NODE) &&                                       \
+    (defined(PERROHT_SEPARATE_HEADER) || defined(PERROHT_SEPARATE_KEY) || \
+     defined(PERROHT_GROUPED_HEADER))
+#error "PERROHT_TAGGED_NODE cannot be combined with other layout macros"
+#endif
+
+/// \brief The layout used if none is specified.
+#if defined(PERROHT_SEPARATE_KEY)
+using DefaultLayout = SeparateKeyLayout;
+#elif defined(PERROHT_SEPARATE_HEADER)
+using DefaultLayout = SeparateHeaderLayout;
+#elif defined(PERROHT_GROUPED_HEADER)
+using DefaultLayout = GroupedHeaderLayout;
+#elif defined(PERROHT_TAGGED_NODE)
+using DefaultLayout = TaggedNodeLayout;
+#else
+using DefaultLayout = InterleavedLayout;
+#endif
+
+}  // namespace perroht
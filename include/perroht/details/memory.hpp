@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace perroht::prhdtls {
 
@@ -36,4 +39,78 @@ inline typename std::pointer_traits<Pointer>::element_type* ToAddress(
   return &(*pointer);
 }
 
-}  // namespace perroht::prhdtls
\ No newline at end of file
+/// \brief True if Alloc provides expand_in_place(p, old_n, new_n), which
+/// tries to grow the allocation at p without moving it.
+template <typename Alloc, typename = void>
+struct HasExpandInPlace : std::false_type {};
+
+template <typename Alloc>
+struct HasExpandInPlace<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().expand_in_place(
+               std::declval<typename AllocTraits<Alloc>::pointer>(),
+               std::size_t(), std::size_t()))>> : std::true_type {};
+
+/// \brief True if Alloc provides shrink_in_place(p, old_n, new_n), which
+/// tries to release the tail of the allocation at p without moving it.
+template <typename Alloc, typename = void>
+struct HasShrinkInPlace : std::false_type {};
+
+template <typename Alloc>
+struct HasShrinkInPlace<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().shrink_in_place(
+               std::declval<typename AllocTraits<Alloc>::pointer>(),
+               std::size_t(), std::size_t()))>> : std::true_type {};
+
+/// \brief True if Alloc provides discard_pages(addr, length), which gives the
+/// pages that are entirely in [addr, addr + length), a range inside a block
+/// it allocated, back to the OS.
+template <typename Alloc, typename = void>
+struct HasDiscardPages : std::false_type {};
+
+template <typename Alloc>
+struct HasDiscardPages<
+    Alloc, std::void_t<decltype(std::declval<Alloc&>().discard_pages(
+               std::declval<void*>(), std::size_t()))>> : std::true_type {};
+
+/// \brief Try to grow the allocation at p from old_n to new_n elements
+/// without moving it. Returns false if Alloc does not support it.
+template <typename Alloc>
+inline bool ExpandInPlace(Alloc& alloc,
+                          typename AllocTraits<Alloc>::pointer p,
+                          const std::size_t old_n, const std::size_t new_n) {
+  if constexpr (HasExpandInPlace<Alloc>::value) {
+    return alloc.expand_in_place(p, old_n, new_n);
+  } else {
+    return false;
+  }
+}
+
+/// \brief Try to shrink the allocation at p from old_n to new_n elements
+/// without moving it. Returns false if Alloc does not support it.
+template <typename Alloc>
+inline bool ShrinkInPlace(Alloc& alloc,
+                          typename AllocTraits<Alloc>::pointer p,
+                          const std::size_t old_n, const std::size_t new_n) {
+  if constexpr (HasShrinkInPlace<Alloc>::value) {
+    return alloc.shrink_in_place(p, old_n, new_n);
+  } else {
+    return false;
+  }
+}
+
+/// \brief Give the pages that are entirely in [addr, addr + length), a range
+/// inside a block allocated by alloc, back to the OS. The contents of the
+/// range are lost. Returns false, leaving the range as it is, if Alloc does
+/// not support it; the memory of other allocators may share pages with
+/// other objects or may not be backed by pages that can be discarded.
+template <typename Alloc>
+inline bool DiscardPages(Alloc& alloc, void* const addr,
+                         const std::size_t length) {
+  if constexpr (HasDiscardPages<Alloc>::value) {
+    return alloc.discard_pages(addr, length);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace perroht::prhdtls
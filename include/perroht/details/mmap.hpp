@@ -5,8 +5,11 @@
 
 #pragma once
 
+#include <cerrno>
 #include <cstdint>
+#include <cstddef>
 #include <sys/mman.h>
+#include <unistd.h>
 
 namespace perroht::prhdtls {
 
@@ -26,4 +29,36 @@ inline bool os_madvise(void *const addr, const size_t length, const int advice,
   return (ret == 0);
 }
 
+/// \brief Returns the page size of the system.
+inline std::size_t os_page_size() {
+  static const std::size_t page_size = [] {
+    const auto ret = ::sysconf(_SC_PAGESIZE);
+    return ret > 0 ? std::size_t(ret) : std::size_t(4096);
+  }();
+  return page_size;
+}
+
+/// \brief Give the pages that are entirely in [addr, addr + length) back to
+/// the OS with madvise(2) and the given advice, e.g., MADV_DONTNEED for
+/// anonymous memory or MADV_REMOVE for shared file mappings.
+/// The contents of the pages are lost; the range must not be read again.
+inline bool os_discard_pages(void *const addr, const size_t length,
+                             const int advice = MADV_DONTNEED) {
+  const auto page_size = os_page_size();
+  const auto begin = reinterpret_cast<uintptr_t>(addr);
+  const auto first = (begin + page_size - 1) / page_size * page_size;
+  const auto last = (begin + length) / page_size * page_size;
+  if (first >= last) {
+    return true;
+  }
+  return os_madvise(reinterpret_cast<void *>(first), last - first, advice);
+}
+
+/// \brief A simple wrapper for msync(2).
+/// \param addr The start address. Must be page aligned.
+inline bool os_msync(void *const addr, const size_t length,
+                     const int flags = MS_SYNC) {
+  return ::msync(addr, length, flags) == 0;
+}
+
 }  // namespace perroht::prhdtls
\ No newline at end of file
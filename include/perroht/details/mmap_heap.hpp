@@ -0,0 +1,277 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#include "mmap.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief The header and heap state of a file-backed segment.
+/// An instance is placed at the beginning of the segment; therefore,
+/// everything but the volatile fields survives reopening the segment.
+/// The segment is always mapped at the same address, so that raw pointers
+/// into the segment stay valid.
+/// Small blocks (up to kMaxSmallSize bytes) are managed by per size class
+/// free lists; larger blocks are page aligned and managed by a first-fit
+/// free extent list. New blocks are carved from the top of the heap, growing
+/// the segment through the grow callback when needed.
+struct MmapHeap {
+  static constexpr uint64_t kMagic = 0x31'54'48'4f'52'52'45'50;  // PERROHT1
+  static constexpr uint64_t kVersion = 1;
+  static constexpr std::size_t kMinSmallSize = 16;
+  static constexpr std::size_t kMaxSmallSize = 2048;
+  static constexpr std::size_t kNumSmallClasses = 8;  // 16B to 2KB
+  static constexpr std::size_t kMaxNameLength = 47;
+  static constexpr std::size_t kMaxNamedObjects = 32;
+
+  using GrowFunc = bool (*)(void* context, std::size_t new_size);
+
+  struct NamedObject {
+    char name[kMaxNameLength + 1];
+    uint64_t offset;  // 0 if unused
+  };
+
+  struct FreeExtent {
+    uint64_t size;
+    uint64_t next;  // offset; 0 if none
+  };
+
+  /// Initialize a new heap whose first byte is this instance.
+  void Init(const std::size_t reserved, const std::size_t mapped) {
+    magic = kMagic;
+    version = kVersion;
+    base_address = reinterpret_cast<uintptr_t>(this);
+    reserved_size = reserved;
+    mapped_size = mapped;
+    top = pAlignUp(sizeof(MmapHeap), os_page_size());
+    std::fill(std::begin(small_free), std::end(small_free), 0);
+    large_free = 0;
+    for (auto& obj : objects) {
+      obj.name[0] = '\0';
+      obj.offset = 0;
+    }
+  }
+
+  /// Set the volatile fields. Called every time the segment is opened.
+  void Attach(GrowFunc grow_func, void* grow_context) {
+    grow = grow_func;
+    context = grow_context;
+    lock.clear();
+  }
+
+  bool Valid() const {
+    return magic == kMagic && version == kVersion &&
+           base_address == reinterpret_cast<uintptr_t>(this);
+  }
+
+  void* Allocate(const std::size_t size, const std::size_t alignment) {
+    LockGuard guard(lock);
+    if (size <= kMaxSmallSize && alignment <= kMinSmallSize) {
+      return pAllocateSmall(size);
+    }
+    return pAllocateLarge(size);
+  }
+
+  void Deallocate(void* const ptr, const std::size_t size,
+                  const std::size_t alignment) {
+    if (!ptr) return;
+    LockGuard guard(lock);
+    if (size <= kMaxSmallSize && alignment <= kMinSmallSize) {
+      const auto cls = pSmallClass(size);
+      *static_cast<uint64_t*>(ptr) = small_free[cls];
+      small_free[cls] = pOffset(ptr);
+    } else {
+      pDeallocateLarge(pOffset(ptr), pAlignUp(size, os_page_size()));
+    }
+  }
+
+  /// Try to grow the large block at ptr from old_size to new_size bytes
+  /// without moving it. Succeeds if the block is at the top of the heap.
+  bool ExpandInPlace(void* const ptr, const std::size_t old_size,
+                     const std::size_t new_size) {
+    if (old_size <= kMaxSmallSize) return false;
+    LockGuard guard(lock);
+    const auto offset = pOffset(ptr);
+    const auto old_end = offset + pAlignUp(old_size, os_page_size());
+    const auto new_end = offset + pAlignUp(new_size, os_page_size());
+    if (old_end != top) return false;
+    if (new_end <= old_end) return true;
+    if (!pReserveTop(new_end)) return false;
+    top = new_end;
+    return true;
+  }
+
+  /// Release the tail of the large block at ptr so that the block holds
+  /// new_size bytes. Fails if either size is not a large block size.
+  bool ShrinkInPlace(void* const ptr, const std::size_t old_size,
+                     const std::size_t new_size) {
+    if (old_size <= kMaxSmallSize || new_size <= kMaxSmallSize) return false;
+    LockGuard guard(lock);
+    const auto offset = pOffset(ptr);
+    const auto old_end = offset + pAlignUp(old_size, os_page_size());
+    const auto new_end = offset + pAlignUp(new_size, os_page_size());
+    if (new_end < old_end) pDeallocateLarge(new_end, old_end - new_end);
+    return new_end <= old_end;
+  }
+
+  /// Return the object registered with the given name, or nullptr.
+  void* Find(const char* const name) const {
+    for (const auto& obj : objects) {
+      if (obj.offset && std::strncmp(obj.name, name, kMaxNameLength) == 0) {
+        return pAddress(obj.offset);
+      }
+    }
+    return nullptr;
+  }
+
+  bool Register(const char* const name, void* const ptr) {
+    if (std::strlen(name) > kMaxNameLength || Find(name)) return false;
+    for (auto& obj : objects) {
+      if (!obj.offset) {
+        std::strncpy(obj.name, name, kMaxNameLength);
+        obj.name[kMaxNameLength] = '\0';
+        obj.offset = pOffset(ptr);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Unregister(const char* const name) {
+    for (auto& obj : objects) {
+      if (obj.offset && std::strncmp(obj.name, name, kMaxNameLength) == 0) {
+        obj.offset = 0;
+        obj.name[0] = '\0';
+      }
+    }
+  }
+
+  // ----- Persistent fields ----- //
+  uint64_t magic;
+  uint64_t version;
+  uintptr_t base_address;
+  uint64_t reserved_size;
+  uint64_t mapped_size;
+  uint64_t top;  // offset of the unused space
+  uint64_t small_free[kNumSmallClasses];
+  uint64_t large_free;
+  NamedObject objects[kMaxNamedObjects];
+
+  // ----- Volatile fields ----- //
+  std::atomic_flag lock;
+  GrowFunc grow;
+  void* context;
+
+ private:
+  class LockGuard {
+   public:
+    explicit LockGuard(std::atomic_flag& flag) : flag_(flag) {
+      while (flag_.test_and_set(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+    ~LockGuard() { flag_.clear(std::memory_order_release); }
+
+   private:
+    std::atomic_flag& flag_;
+  };
+
+  static constexpr std::size_t pAlignUp(const std::size_t n,
+                                        const std::size_t alignment) {
+    return (n + alignment - 1) / alignment * alignment;
+  }
+
+  static std::size_t pSmallClass(const std::size_t size) {
+    std::size_t cls = 0;
+    while ((kMinSmallSize << cls) < size) ++cls;
+    return cls;
+  }
+
+  inline uint64_t pOffset(const void* const ptr) const {
+    return reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(this);
+  }
+
+  inline void* pAddress(const uint64_t offset) const {
+    return reinterpret_cast<std::byte*>(const_cast<MmapHeap*>(this)) + offset;
+  }
+
+  // Make sure that [0, end) is mapped.
+  bool pReserveTop(const uint64_t end) {
+    if (end <= mapped_size) return true;
+    if (end > reserved_size || !grow) return false;
+    const auto new_size =
+        std::min<uint64_t>(reserved_size, std::max(end, mapped_size * 2));
+    if (!grow(context, new_size)) return false;
+    mapped_size = new_size;
+    return true;
+  }
+
+  void* pAllocateSmall(const std::size_t size) {
+    const auto cls = pSmallClass(size);
+    if (small_free[cls]) {
+      const auto offset = small_free[cls];
+      small_free[cls] = *static_cast<uint64_t*>(pAddress(offset));
+      return pAddress(offset);
+    }
+    const auto block_size = kMinSmallSize << cls;
+    const auto offset = pAlignUp(top, kMinSmallSize);
+    if (!pReserveTop(offset + block_size)) return nullptr;
+    top = offset + block_size;
+    return pAddress(offset);
+  }
+
+  void* pAllocateLarge(const std::size_t size) {
+    const auto block_size = pAlignUp(size, os_page_size());
+
+    // First fit
+    uint64_t* link = &large_free;
+    while (*link) {
+      auto* const extent = static_cast<FreeExtent*>(pAddress(*link));
+      if (extent->size >= block_size) {
+        const auto offset = *link;
+        if (extent->size > block_size) {
+          auto* const rest =
+              static_cast<FreeExtent*>(pAddress(offset + block_size));
+          rest->size = extent->size - block_size;
+          rest->next = extent->next;
+          *link = offset + block_size;
+        } else {
+          *link = extent->next;
+        }
+        return pAddress(offset);
+      }
+      link = &extent->next;
+    }
+
+    const auto offset = pAlignUp(top, os_page_size());
+    if (!pReserveTop(offset + block_size)) return nullptr;
+    top = offset + block_size;
+    return pAddress(offset);
+  }
+
+  void pDeallocateLarge(const uint64_t offset, const std::size_t block_size) {
+    if (offset + block_size == top) {
+      top = offset;
+      // Give the pages back to the file system.
+      os_madvise(pAddress(offset), block_size, MADV_REMOVE);
+      return;
+    }
+    auto* const extent = static_cast<FreeExtent*>(pAddress(offset));
+    extent->size = block_size;
+    extent->next = large_free;
+    large_free = offset;
+  }
+};
+
+}  // namespace perroht::prhdtls
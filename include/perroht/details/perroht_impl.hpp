@@ -6,12 +6,19 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -22,12 +29,21 @@
 #include "header.hpp"
 #include "data_holder.hpp"
 #include "key_value_traits.hpp"
+#include "layout.hpp"
+#include "process_local.hpp"
 #include "capacity_algorithms.hpp"
+#include "change_log.hpp"
+#include "dirty_page_map.hpp"
+#include "redo_log.hpp"
+#include "resize_descriptor.hpp"
+#include "snapshot.hpp"
+#include "type_traits.hpp"
+#include "warm_up.hpp"
 
 namespace perroht::prhdtls {
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 class PerrohtImpl {
  private:
   using KVTraits = KeyValueTraits<Key, Value, embed>;
@@ -44,9 +60,18 @@ class PerrohtImpl {
   using Allocator = RebindAlloc<Alloc, KeyValueType>;
 
  private:
-  using SelfType = PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>;
-
-  using DataHolderType = DataHolder<KeyValueType, embed, Allocator>;
+  using SelfType =
+      PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>;
+
+  // If true, node pointers are packed with a fingerprint of the key into
+  // 7-byte data holders (see TaggedNodeLayout); a lookup dereferences a node
+  // only if the fingerprints match.
+  static constexpr bool kTaggedNode =
+      Layout::kTaggedNode && !embed &&
+      std::is_pointer_v<typename AllocTraits<Allocator>::pointer>;
+
+  using DataHolderType =
+      DataHolder<KeyValueType, embed, Allocator, kTaggedNode>;
   using ByteAllocator = RebindAlloc<Allocator, std::byte>;
   using BytePointer = typename AllocTraits<ByteAllocator>::pointer;
   using ConstBytePointer = typename AllocTraits<ByteAllocator>::const_pointer;
@@ -56,9 +81,20 @@ class PerrohtImpl {
   using DataAllocator = RebindAlloc<Allocator, DataHolderType>;
   using DataPointer = typename AllocTraits<DataAllocator>::pointer;
 
+  using ResizeDescriptorType =
+      ResizeDescriptor<BytePointer, CapacityAlgo::IndexType, SizeType>;
+  using DirtyPageMapType = DirtyPageMap<ByteAllocator>;
+  using RedoLogType = RedoLog<KeyType, KeyValueType, Allocator>;
+  using RedoLogAllocator = RebindAlloc<Allocator, RedoLogType>;
+  using RedoLogPointer = typename AllocTraits<RedoLogAllocator>::pointer;
+  using SnapshotType = TableSnapshot<ByteAllocator>;
+
   template <bool IsConst>
   class BaseIterator;
 
+  template <bool IsConst>
+  class BaseView;
+
   static constexpr SizeType kNullPos = std::numeric_limits<SizeType>::max();
 
   // The maximum load factor value used to determine automatic capacity change.
@@ -68,12 +104,72 @@ class PerrohtImpl {
   // this value.
   static constexpr double kAutoGrowProbeDistance = 10;
 
+  // The number of elements the overflow stash can hold
+  // (see StashProbeBound()).
+  static constexpr SizeType kStashCapacity = 32;
+
+  // The number of table bytes migrated between releasing the memory of the
+  // source table (see pMigrateEntriesFrom()).
+  static constexpr SizeType kMigrationChunkSize = SizeType(64) << 20;
+
+  // If true, entries can be duplicated into a new table without modifying
+  // the old one (see DataHolder::MakeShallowCopy()).
+  // Resizing such tables is crash-consistent.
+  static constexpr bool kShallowCopyableEntry =
+      !embed || IsBitwiseCopyableV<KeyValueType>;
+
+  // If true, embedded entries are moved between positions and tables by
+  // copying their bytes (see IsTriviallyRelocatable); the source positions
+  // are not destroyed.
+  static constexpr bool kRelocatableEntry =
+      embed && IsTriviallyRelocatableV<KeyValueType>;
+
+  // If true, a table can be duplicated by copying its bytes, including the
+  // headers, and its entries need not be destroyed.
+  static constexpr bool kBitwiseCopyableTable =
+      embed && IsBitwiseCopyableV<KeyValueType>;
+
+  // If true, the table supports copy-on-write snapshots (see TakeSnapshot()).
+  // A snapshot copies table pages only; thus, elements must be embedded and
+  // bitwise copyable.
+  static constexpr bool kSnapshotSupported = kBitwiseCopyableTable;
+
+  // The offsets of the headers, keys, and data in a table (see layout.hpp).
+  using LayoutOffsets =
+      typename Layout::template Offsets<Header, KeyType, DataHolderType>;
+
+  // If true, the headers form an array of their own, followed by the data;
+  // the offset of the data at a position depends on the capacity.
+  static constexpr bool kSeparateHeader = LayoutOffsets::kSeparateHeader;
+
+  // If true, a copy of the key of each entry is kept in a key array, so that
+  // probes touch the headers and keys only. The data is read on a hit only.
+  static constexpr bool kKeyArray = LayoutOffsets::kKeyArray;
+
+  // The number of positions stored together in a block. The memory of a
+  // table can be given back to the OS block by block only.
+  static constexpr SizeType kGroupSize = LayoutOffsets::kGroupSize;
+
+  // If true, changes can be recorded in a change log (see AttachChangeLog()).
+  static constexpr bool kChangeLogSupported =
+      IsBitwiseCopyableV<KeyType> && IsBitwiseCopyableV<KeyValueType>;
+
  public:
   using Iterator = BaseIterator<false>;
   using ConstIterator = BaseIterator<true>;
+  using View = BaseView<false>;
+  using ConstView = BaseView<true>;
+  using BatchOperationType = typename RedoLogType::OperationType;
+  class SnapshotView;
+  using ChangeLogType = ChangeLog<KeyType, KeyValueType>;
+  using WarmUpTaskType = WarmUpTask;
 
   static constexpr bool Embed() { return embed; }
 
+  static constexpr SizeType MaxProbeDistance() {
+    return Header::MaxProbeDistance();
+  }
+
   PerrohtImpl() = default;
 
   PerrohtImpl(const SizeType initial_capacity, const float max_load_factor,
@@ -94,6 +190,7 @@ class PerrohtImpl {
                 other.allocator_)),
         hasher_(other.hasher_),
         key_equal_(other.key_equal_) {
+    StashProbeBound(other.StashProbeBound());
     pCopyConstructEntriesIndividuallyFrom(other);
   }
 
@@ -105,11 +202,13 @@ class PerrohtImpl {
         mean_probe_distance_(std::move(other.mean_probe_distance_)),
         size_(std::move(other.size_)),
         capacity_index_(std::move(other.capacity_index_)),
-        table_(std::move(other.table_)) {
+        table_(std::move(other.table_)),
+        side_(std::move(other.side_)) {
     other.mean_probe_distance_ = 0;
     other.size_ = 0;
     other.capacity_index_ = 0;
     other.table_ = nullptr;
+    other.side_ = nullptr;
   }
 
   PerrohtImpl(const PerrohtImpl& other, const Allocator& alloc)
@@ -117,6 +216,7 @@ class PerrohtImpl {
         allocator_(alloc),
         hasher_(other.hasher_),
         key_equal_(other.key_equal_) {
+    StashProbeBound(other.StashProbeBound());
     pCopyConstructEntriesIndividuallyFrom(other);
   }
 
@@ -127,21 +227,29 @@ class PerrohtImpl {
         key_equal_(std::move(other.key_equal_)) {
     if (other.allocator_ == alloc) {
       // Move all members
-      mean_probe_distance_ = std::move(other.mean_probe_distance_);
-      size_ = std::move(other.size_);
-      capacity_index_ = std::move(other.capacity_index_);
-      table_ = std::move(other.table_);
-
-      other.mean_probe_distance_ = 0;
-      other.size_ = 0;
-      other.capacity_index_ = 0;
-      other.table_ = nullptr;
+      pMoveMembersFrom(other);
     } else {
       // Move construct each element individually
+      StashProbeBound(other.StashProbeBound());
       pMoveConstructEntriesIndividuallyFrom(std::move(other));
     }
   }
 
+  /// Move construct from a container that uses another allocator type, e.g.,
+  /// to persist a table built with std::allocator. See pMigrateEntriesFrom().
+  template <typename OtherAlloc>
+  PerrohtImpl(
+      PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, OtherAlloc, Layout>&&
+          other,
+      const Allocator& alloc)
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(alloc),
+        hasher_(std::move(other.hasher_)),
+        key_equal_(std::move(other.key_equal_)) {
+    StashProbeBound(other.StashProbeBound());
+    pMigrateEntriesFrom(other);
+  }
+
   PerrohtImpl& operator=(const PerrohtImpl& other) {
     if (this == &other) return *this;
     pFreeTable();
@@ -149,6 +257,7 @@ class PerrohtImpl {
     max_load_factor_ = other.max_load_factor_;
     hasher_ = other.hasher_;
     key_equal_ = other.key_equal_;
+    StashProbeBound(other.StashProbeBound());
     using CopyAlloc =
         typename AllocTraits<Allocator>::propagate_on_container_copy_assignment;
     if constexpr (std::is_same_v<CopyAlloc, std::true_type>) {
@@ -168,32 +277,36 @@ class PerrohtImpl {
     key_equal_ = std::move(other.key_equal_);
     constexpr auto propagate_alloc = typename AllocTraits<
         Allocator>::propagate_on_container_move_assignment();
+    const bool move_data = propagate_alloc || allocator_ == other.allocator_;
+    if (move_data) {
+      // The side state is replaced by other's; free it with the current
+      // allocator.
+      pFreeRedoLog();
+      pFreeSide();
+    }
     if constexpr (propagate_alloc) {
       allocator_ = std::move(other.allocator_);
     }
 
-    if (propagate_alloc || allocator_ == other.allocator_) {
+    if (move_data) {
       // As other's allocator was propagated or the same as the current one,
       // we can just move the data.
-      mean_probe_distance_ = std::move(other.mean_probe_distance_);
-      size_ = std::move(other.size_);
-      capacity_index_ = std::move(other.capacity_index_);
-      table_ = std::move(other.table_);
-
-      other.mean_probe_distance_ = 0;
-      other.size_ = 0;
-      other.capacity_index_ = 0;
-      other.table_ = nullptr;
+      pMoveMembersFrom(other);
     } else {
       // As two allocators are not the same, we need to move construct each
       // element.
+      StashProbeBound(other.StashProbeBound());
       pMoveConstructEntriesIndividuallyFrom(std::move(other));
     }
 
     return *this;
   }
 
-  ~PerrohtImpl() noexcept { pFreeTable(); }
+  ~PerrohtImpl() noexcept {
+    pFreeTable();
+    pFreeRedoLog();
+    pFreeSide();
+  }
 
   void Swap(PerrohtImpl& other) noexcept {
     using std::swap;
@@ -215,17 +328,20 @@ class PerrohtImpl {
     swap(size_, other.size_);
     swap(capacity_index_, other.capacity_index_);
     swap(table_, other.table_);
+    swap(side_, other.side_);
   }
 
-  template <typename K, typename V, typename H, typename E, bool e, typename A>
+  template <typename K, typename V, typename H, typename E, bool e, typename A,
+            typename L>
   friend constexpr bool operator==(
-      const PerrohtImpl<K, V, H, E, e, A>& lhd,
-      const PerrohtImpl<K, V, H, E, e, A>& rhd) noexcept;
+      const PerrohtImpl<K, V, H, E, e, A, L>& lhd,
+      const PerrohtImpl<K, V, H, E, e, A, L>& rhd) noexcept;
 
-  template <typename K, typename V, typename H, typename E, bool e, typename A>
+  template <typename K, typename V, typename H, typename E, bool e, typename A,
+            typename L>
   friend constexpr bool operator!=(
-      const PerrohtImpl<K, V, H, E, e, A>& lhd,
-      const PerrohtImpl<K, V, H, E, e, A>& rhd) noexcept;
+      const PerrohtImpl<K, V, H, E, e, A, L>& lhd,
+      const PerrohtImpl<K, V, H, E, e, A, L>& rhd) noexcept;
 
   template <typename KVType>
   inline std::pair<Iterator, bool> Insert(KVType&& data) {
@@ -235,8 +351,10 @@ class PerrohtImpl {
     if (found) {
       return {Iterator(pos, this), false};
     }
-    auto d = pConstructDataHolder(std::forward<KVType>(data));
-    pos = pInsert(true, std::move(d), pos);
+    const bool aliased = pAnyInTable(data);
+    pos = pInsertInPlace(KVTraits::GetKey(data), pos, aliased,
+                         std::forward<KVType>(data));
+    pLogInsert(pos);
     return {Iterator(pos, this), true};
   }
 
@@ -257,59 +375,18 @@ class PerrohtImpl {
       }
     }
     pos = pInsert(true, std::move(data));
+    pLogInsert(pos);
     return {Iterator(pos, this), true};
   }
 
   template <typename... Args>
   std::pair<Iterator, bool> TryEmplace(const KeyType& key, Args&&... args) {
-    SizeType pos = kNullPos;
-    {
-      bool found = false;
-      std::tie(pos, found) = pLocate(key);
-      if (found) {
-        return {Iterator(pos, this), false};
-      }
-    }
-
-    DataHolderType data(allocator_);
-    if constexpr (std::is_same_v<Value, VoidValue>) {
-      RebindAllocTraits<Allocator, KeyValueType>::construct(allocator_,
-                                                            &data.Get(), key);
-    } else {
-      RebindAllocTraits<Allocator, KeyValueType>::construct(
-          allocator_, &data.Get(), std::piecewise_construct,
-          std::forward_as_tuple(key), std::forward_as_tuple(args...));
-    }
-
-    pos = pInsert(true, std::move(data), pos);
-    return {Iterator(pos, this), true};
+    return pTryEmplace(key, std::forward<Args>(args)...);
   }
 
-  // TODO: reduce code duplication
   template <typename... Args>
   std::pair<Iterator, bool> TryEmplace(KeyType&& key, Args&&... args) {
-    SizeType pos = SizeType(-1);
-    {
-      bool found = false;
-      std::tie(pos, found) = pLocate(key);
-      if (found) {
-        return {Iterator(pos, this), false};
-      }
-    }
-
-    DataHolderType data(allocator_);
-    if constexpr (std::is_same_v<Value, VoidValue>) {
-      RebindAllocTraits<Allocator, KeyValueType>::construct(
-          allocator_, &data.Get(), std::move(key));
-    } else {
-      RebindAllocTraits<Allocator, KeyValueType>::construct(
-          allocator_, &data.Get(), std::piecewise_construct,
-          std::forward_as_tuple(std::move(key)),
-          std::forward_as_tuple(args...));
-    }
-
-    pos = pInsert(true, std::move(data), pos);
-    return {Iterator(pos, this), true};
+    return pTryEmplace(std::move(key), std::forward<Args>(args)...);
   }
 
   inline SizeType Count(const KeyType& key) const {
@@ -334,6 +411,12 @@ class PerrohtImpl {
 
   inline bool Contains(const KeyType& key) const { return pLocate(key).second; }
 
+  /// Return a view that resolves the table address once so that a batch of
+  /// operations works on raw pointers. See BaseView.
+  inline View GetView() { return View(this); }
+
+  inline ConstView GetView() const { return ConstView(this); }
+
   inline SizeType Erase(const KeyType& key) {
     return pEraseSingle(key) ? 1 : 0;
   }
@@ -342,25 +425,25 @@ class PerrohtImpl {
     if (it == End()) {
       return End();
     }
-    auto pos = it.Position();
+    const auto pos = it.Position();
+    // If the shift moves the entry at position 0, which has been visited
+    // already, to the last position, the returned iterator passes over it.
+    const auto skip = pos < Capacity() && pEraseShiftWrapsAround(pos)
+                          ? Capacity() - 1
+                          : kNullPos;
     pEraseSingleAt(pos);
 
-    // Find the next valid entry.
-    for (SizeType i = 0; i < Capacity(); ++i) {
-      if (!pGetHeader(pos).Empty()) {
-        return Iterator(pos, this);
-      }
-      pos = pIncrementPosition(pos);
-    }
-
-    return End();
+    // The following entries have been shifted back by one position; thus,
+    // the next entry is at pos or after it. Do not wrap around to the
+    // entries that have been visited already.
+    return Iterator(pos, this, skip);
   }
 
   inline Iterator Erase(const ConstIterator it) {
     return Erase(Iterator(it.Position(), this));
   }
 
-  inline SizeType Size() const { return size_; }
+  inline SizeType Size() const { return size_ + pStashSize(); }
 
   inline SizeType MaxSize() const noexcept {
     return std::allocator_traits<Allocator>::max_size(allocator_);
@@ -372,7 +455,12 @@ class PerrohtImpl {
     return CapacityAlgo::ToCapacity(capacity_index_);
   }
 
-  inline void Clear() noexcept { pClearAll(); }
+  inline void Clear() noexcept {
+    if constexpr (kChangeLogSupported) {
+      if (auto* const log = GetChangeLog()) log->RecordClear();
+    }
+    pClearAll();
+  }
 
   inline Iterator Begin() { return Iterator(0, this); }
 
@@ -380,11 +468,15 @@ class PerrohtImpl {
 
   inline ConstIterator CBegin() const { return ConstIterator(0, this); }
 
-  inline Iterator End() { return Iterator(Capacity(), this); }
+  inline Iterator End() { return Iterator(pEndPosition(), this); }
 
-  inline ConstIterator End() const { return ConstIterator(Capacity(), this); }
+  inline ConstIterator End() const {
+    return ConstIterator(pEndPosition(), this);
+  }
 
-  inline ConstIterator CEnd() const { return ConstIterator(Capacity(), this); }
+  inline ConstIterator CEnd() const {
+    return ConstIterator(pEndPosition(), this);
+  }
 
   bool Reserve(const SizeType capacity) {
     if (capacity <= Capacity()) {
@@ -392,6 +484,11 @@ class PerrohtImpl {
     }
 
     const auto new_capacity = CapacityAlgo::AdjustCapacity(capacity);
+    if (pResizeInPlace(new_capacity)) {
+      pDrainStash(true);
+      return true;
+    }
+
     auto new_table = pAllocateTable(new_capacity);
     if (!new_table) {
       pFreeTable();
@@ -400,8 +497,10 @@ class PerrohtImpl {
 
     // As we are increasing the capacity, we don't need to check the capacity.
     constexpr bool check_capacity = false;
-    return pTransferEntriesTo(std::move(new_table), new_capacity,
-                              check_capacity);
+    const bool transferred = pTransferEntriesTo(std::move(new_table),
+                                                new_capacity, check_capacity);
+    pDrainStash(true);
+    return transferred;
   }
 
   bool Rehash(const SizeType capacity_request) {
@@ -412,6 +511,11 @@ class PerrohtImpl {
     assert(pEnoughCapacity(Size(), new_capacity) &&
            "new_capacity_index is too small to hold existing elements");
 
+    if (pResizeInPlace(new_capacity)) {
+      pDrainStash(true);
+      return true;
+    }
+
     auto new_table = pAllocateTable(new_capacity);
     if (!new_table) {
       pFreeTable();
@@ -419,8 +523,10 @@ class PerrohtImpl {
     }
 
     constexpr bool check_capacity = true;
-    return pTransferEntriesTo(std::move(new_table), new_capacity,
-                              check_capacity);
+    const bool transferred = pTransferEntriesTo(std::move(new_table),
+                                                new_capacity, check_capacity);
+    pDrainStash(true);
+    return transferred;
   }
 
   inline bool ShrinkToFit() { return Rehash(Size()); }
@@ -453,6 +559,33 @@ class PerrohtImpl {
     return mean_probe_distance_;
   }
 
+  /// Bound the probe distances of the elements inserted from now on.
+  /// An element that would be placed farther than stash_probe_bound from
+  /// its ideal position, or would push another element that far, is moved to
+  /// a small overflow stash of kStashCapacity elements instead. Lookups
+  /// search the stash only when it is not empty. While the stash has room,
+  /// the table grows only by the load factor rather than also when the mean
+  /// probe distance becomes long. The stashed elements are moved back to the
+  /// table when it is resized.
+  /// The stash is not part of the table; thus, nothing is stashed while the
+  /// dirty pages are tracked, a snapshot exists, or a batch is applied, and
+  /// the stash is emptied when one of them starts.
+  /// The maximum value of SizeType, the default, disables the bound.
+  inline void StashProbeBound(const SizeType stash_probe_bound) {
+    if (stash_probe_bound != kNullPos || side_) {
+      pGetSide().stash_probe_bound = stash_probe_bound;
+      pReleaseIdleSide();
+    }
+  }
+
+  inline SizeType StashProbeBound() const noexcept {
+    const auto* const side = pFindSide();
+    return side ? side->stash_probe_bound : kNullPos;
+  }
+
+  /// Return the number of elements in the overflow stash.
+  inline SizeType StashSize() const noexcept { return pStashSize(); }
+
   std::tuple<SizeType, double, SizeType> GetProbeDistanceStats()
       const noexcept {
     SizeType min_dist = 0;
@@ -480,6 +613,385 @@ class PerrohtImpl {
     return histogram;
   }
 
+  static constexpr bool CrashConsistentResize() {
+    return kShallowCopyableEntry;
+  }
+
+  static constexpr bool CrashConsistentBatch() {
+    return kBitwiseCopyableTable;
+  }
+
+  /// Grow and shrink the table in place instead of building a new table
+  /// next to the current one, so that the peak memory usage of a resize is
+  /// the size of the new table only.
+  /// Requires an allocator that can extend an allocation without moving it,
+  /// i.e., provides expand_in_place() and, for shrinking, shrink_in_place()
+  /// (see perroht::mmap_allocator). When the allocation cannot be extended,
+  /// or a snapshot exists, the usual resize is performed.
+  /// Unlike the usual resize, an in-place resize is not crash-consistent;
+  /// Recover() fails if one was interrupted.
+  /// Returns false, leaving the mode disabled, if the allocator does not
+  /// support it.
+  bool ResizeInPlace(const bool enable) {
+    const bool resize_in_place =
+        enable && HasExpandInPlace<ByteAllocator>::value;
+    if (resize_in_place || side_) {
+      pGetSide().resize_in_place = resize_in_place;
+      pReleaseIdleSide();
+    }
+    return resize_in_place == enable;
+  }
+
+  inline bool ResizingInPlace() const noexcept {
+    const auto* const side = pFindSide();
+    return side && side->resize_in_place;
+  }
+
+  /// Finish or roll back a resize that was interrupted by an abnormal
+  /// termination. A resize that had not been committed is rolled back, i.e.,
+  /// the table is left as it was before the resize started. A committed one is
+  /// finished. Does nothing if no resize was in progress.
+  /// Then, a batch committed to the redo log is applied again to the table
+  /// restored from the undo images (see ApplyBatch()), and a batch that had
+  /// not been committed is discarded.
+  /// Snapshots and change logs do not survive the process that set them;
+  /// they are detached, without being released, in case the container was
+  /// reopened by the same process.
+  /// Returns false if the interrupted resize cannot be recovered.
+  bool Recover() {
+    if (auto* const side = pFindSide()) {
+      side->snapshot.Reset();
+      side->change_log.Reset();
+    }
+    const bool recovered = pRecoverResize() && pRecoverRedoLog();
+    pReleaseIdleSide();
+    return recovered;
+  }
+
+  /// Apply the given insertions and erasures as a single atomic batch.
+  /// The operations are written to a redo log and the log is flushed once
+  /// before they are applied to the table. Before a table page is modified
+  /// for the first time in the batch, its undo image is flushed to the log.
+  /// The modified table pages are flushed before the log is cleared.
+  /// If the process dies in between, Recover() copies the undo images back
+  /// and applies the batch again.
+  /// The table is grown for the insertions before the batch is logged so
+  /// that applying the batch never resizes the table.
+  /// Returns false if the batch could not be logged, in which case the table
+  /// is unchanged, or if the table could not be flushed, in which case the
+  /// batch is kept in the log and is applied again by Recover().
+  /// Only the undo images of tables whose elements are embedded and bitwise
+  /// copyable can restore them (see CrashConsistentBatch()); for other
+  /// tables, Recover() fails if the batch was interrupted while it was
+  /// applied.
+  template <typename Operations>
+  bool ApplyBatch(const Operations& ops) {
+    auto* const redo_log = pResizeIdle() ? pGetRedoLog() : nullptr;
+    if (!redo_log || redo_log->GetState() != RedoLogType::State::kEmpty) {
+      return false;
+    }
+    pDrainStash(false);
+
+    SizeType num_inserts = 0;
+    for (const auto& op : ops) {
+      num_inserts += op.type == BatchOperationType::Type::kInsert;
+    }
+    const auto required_size = Size() + num_inserts;
+    if (!pEnoughCapacity(required_size) &&
+        !Reserve(pGetRequiredCapacity(required_size))) {
+      return false;
+    }
+
+    if (!redo_log->Write(allocator_, ops) ||
+        !redo_log->Commit(size_, mean_probe_distance_)) {
+      redo_log->Clear(allocator_);
+      return false;
+    }
+    if constexpr (!kBitwiseCopyableTable) {
+      if (!redo_log->BeginApplying()) {
+        redo_log->Clear(allocator_);
+        return false;
+      }
+    }
+    return pReplayRedoLog();
+  }
+
+  /// Return the number of operations in the redo log that have not been
+  /// cleared yet.
+  SizeType NumPendingBatchOperations() const {
+    const auto* const redo_log = pFindRedoLog();
+    return redo_log ? redo_log->NumOperations() : 0;
+  }
+
+
+  /// Check the invariants of the table in parallel.
+  /// Verifies that every entry is stored at a position reachable from its
+  /// ideal position with the recorded probe distance, that the Robin Hood
+  /// ordering holds, that there is no duplicate key, and that the number of
+  /// entries matches Size().
+  /// Takes O(n) time, where n is the capacity of the table.
+  bool CheckIntegrity(
+      const SizeType num_threads = std::thread::hardware_concurrency()) const {
+    if (!pResizeIdle()) {
+      return false;
+    }
+    if (Capacity() == 0) {
+      return Size() == 0 && !table_;
+    }
+
+    const SizeType num_chunks =
+        std::max(SizeType(1), std::min(num_threads, Capacity()));
+    const SizeType chunk_size = (Capacity() + num_chunks - 1) / num_chunks;
+    std::vector<SizeType> counts(num_chunks, 0);
+    std::vector<char> results(num_chunks, true);
+
+    const auto check_range = [&](const SizeType chunk) {
+      const SizeType begin = chunk * chunk_size;
+      const SizeType end = std::min(begin + chunk_size, Capacity());
+      for (SizeType pos = begin; pos < end; ++pos) {
+        if (pGetHeader(pos).Empty()) {
+          continue;
+        }
+        ++counts[chunk];
+        if (!pCheckEntry(pos)) {
+          results[chunk] = false;
+          return;
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (SizeType chunk = 1; chunk < num_chunks; ++chunk) {
+      threads.emplace_back(check_range, chunk);
+    }
+    check_range(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    SizeType count = 0;
+    for (SizeType chunk = 0; chunk < num_chunks; ++chunk) {
+      if (!results[chunk]) {
+        return false;
+      }
+      count += counts[chunk];
+    }
+    if (count != size_) {
+      return false;
+    }
+
+    // Stashed elements must be found in the stash.
+    for (SizeType i = 0; i < pStashSize(); ++i) {
+      const auto [pos, found] =
+          pLocate(KVTraits::GetKey(pGetStashData(i).Get()));
+      if (!found || pos != Capacity() + i) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Start or stop recording the pages modified by this container.
+  /// When started, all pages are considered clean, i.e., the caller is
+  /// expected to have flushed the table already.
+  /// Returns false if the tracking data could not be allocated.
+  bool TrackDirtyPages(const bool enable) {
+    if (enable) {
+      pDrainStash(false);
+    }
+    if (enable || side_) {
+      pGetSide().track_dirty_pages = enable;
+    }
+    const bool reset = pResetDirtyPages(false);
+    pReleaseIdleSide();
+    return reset;
+  }
+
+  inline bool TrackingDirtyPages() const noexcept {
+    const auto* const side = pFindSide();
+    return side && side->track_dirty_pages;
+  }
+
+  /// Record that the value of the element pointed by the iterator is going to
+  /// be modified by the caller.
+  /// Only needed for updates made through iterators or references;
+  /// insertions and erasures are recorded by the container.
+  template <bool IsConst>
+  inline void MarkDirty(const BaseIterator<IsConst>& it) {
+    if (it.Position() < Capacity()) {
+      pBeforeWrite(it.Position());
+    }
+  }
+
+  /// Return the number of the table pages modified since the last sync.
+  SizeType NumDirtyPages() const {
+    const auto dirty_pages = pDirtyPages();
+    if (!dirty_pages) {
+      return 0;
+    }
+    return DirtyPageMapType::CountDirtyPages(dirty_pages);
+  }
+
+  /// Flush the modified pages to the backing file with msync(2).
+  /// Only the pages recorded since the last sync are flushed, coalesced into
+  /// as few ranges as possible, along with the pages of this container and
+  /// of its side state, which hold the size, the capacity, and the stash.
+  /// Does nothing if the dirty pages are not tracked.
+  bool Sync() { return SyncMemoryRanges(pTakeDirtyRanges()); }
+
+  /// Return the ranges Sync() would flush and mark the dirty pages clean.
+  /// The caller is responsible for flushing the ranges.
+  std::vector<MemoryRange> TakeSyncRanges() { return pTakeDirtyRanges(); }
+
+  /// Asynchronous version of Sync().
+  /// The ranges to flush are determined when this function is called;
+  /// the container can be modified while the flush is in progress.
+  /// If the table is resized before the returned future becomes ready,
+  /// the flush of the released table may fail.
+  std::future<bool> SyncAsync() {
+    return std::async(std::launch::async,
+                      [ranges = pTakeDirtyRanges()]() {
+                        return SyncMemoryRanges(ranges);
+                      });
+  }
+
+  /// Prefault the table on background threads, e.g., after reopening a
+  /// persistent segment, so that lookups stop taking page faults quickly.
+  /// The headers are prefaulted first if they are stored separately from the
+  /// data; then, the data; then, the nodes if entries are not embedded.
+  /// Lookups can be served while the warm-up is in progress. The table must
+  /// not be resized or destroyed until the returned task is done or
+  /// destroyed.
+  std::unique_ptr<WarmUpTaskType> WarmUp(const SizeType num_threads) const {
+    std::vector<WarmUpTaskType::Job> jobs;
+    if (Capacity() > 0) {
+      if constexpr (kSeparateHeader) {
+        // The headers and the key array, if any, precede the data.
+        WarmUpTaskType::AddPrefaultJobs(&pGetHeader(0),
+                                        pDataOffset(Capacity(), 0), jobs);
+        WarmUpTaskType::AddPrefaultJobs(
+            &pGetData(0), Capacity() * sizeof(DataHolderType), jobs);
+      } else {
+        WarmUpTaskType::AddPrefaultJobs(ToAddress(table_),
+                                        pGetMemorySize(Capacity()), jobs);
+      }
+      if constexpr (!embed) {
+        const auto chunk = std::max(
+            SizeType(1), WarmUpTaskType::kChunkSize / sizeof(DataHolderType));
+        for (SizeType begin = 0; begin < Capacity(); begin += chunk) {
+          const auto end = std::min(Capacity(), begin + chunk);
+          jobs.emplace_back([this, begin, end]() {
+            for (auto pos = begin; pos < end; ++pos) {
+              if (!pGetHeader(pos).Empty()) {
+                WarmUpTaskType::TouchPages(&pGetData(pos).Get(),
+                                           sizeof(KeyValueType));
+              }
+            }
+          });
+        }
+      }
+    }
+    return std::make_unique<WarmUpTaskType>(std::move(jobs), num_threads);
+  }
+
+  /// Take a copy-on-write snapshot of the table.
+  /// The snapshot can be read by another thread while this container is
+  /// modified. Before modifying a table page for the first time after the
+  /// snapshot was taken, the container copies the page, so the cost is
+  /// proportional to the number of modified pages rather than the table
+  /// size. If the table is resized or destroyed, the old table is handed over
+  /// to the snapshot.
+  /// Only one snapshot can exist at a time. Returns an invalid view if the
+  /// previous snapshot has not been released yet.
+  SnapshotView TakeSnapshot() {
+    static_assert(kSnapshotSupported,
+                  "Snapshots require embedded, bitwise copyable elements");
+    if (auto* const snapshot = pSnapshot()) {
+      if (snapshot->Shared()) {
+        return SnapshotView();
+      }
+      pDropSnapshot();
+    }
+    if (Capacity() == 0) {
+      return SnapshotView(nullptr, nullptr, 0, 0, hasher_, key_equal_);
+    }
+    pDrainStash(false);
+    auto* const snapshot =
+        new SnapshotType(ByteAllocator(allocator_), ToAddress(table_),
+                         pGetMemorySize(Capacity()));
+    pGetSide().snapshot.Reset(snapshot);
+    return SnapshotView(snapshot, ToAddress(table_), Capacity(), Size(),
+                        hasher_, key_equal_);
+  }
+
+  /// Record the following insertions, updates, and erasures in the given
+  /// change log. Pass nullptr to stop recording.
+  /// The log is not owned by this container.
+  void AttachChangeLog(ChangeLogType* const change_log) {
+    static_assert(kChangeLogSupported,
+                  "Change logs require trivially copyable elements");
+    if (change_log || side_) {
+      pGetSide().change_log.Reset(change_log);
+      pReleaseIdleSide();
+    }
+  }
+
+  inline ChangeLogType* GetChangeLog() const noexcept {
+    const auto* const side = pFindSide();
+    return side ? side->change_log.Get() : nullptr;
+  }
+
+  /// Update the value of the element pointed by the iterator.
+  /// Unlike updating the value through the iterator, the update is also
+  /// recorded in the dirty pages, the snapshot, and the change log.
+  template <typename V>
+  void UpdateValue(const Iterator& it, V&& value) {
+    static_assert(!std::is_same_v<Value, VoidValue>,
+                  "Only maps have values to update");
+    if (it.Position() < Capacity()) {
+      pBeforeWrite(it.Position());
+    }
+    it->second = std::forward<V>(value);
+    if constexpr (kChangeLogSupported) {
+      if (auto* const log = GetChangeLog()) log->RecordUpdate(*it);
+    }
+  }
+
+  /// Apply the changes recorded in the change log in the given directory
+  /// whose sequence numbers are larger than after_sequence.
+  /// An insertion or update event inserts the element or overwrites the value
+  /// of the existing one.
+  /// Returns false if some of the requested changes are no longer in the
+  /// log; in that case, the changes found were applied up to the gap.
+  bool ApplyChanges(const std::string& log_dir, const uint64_t after_sequence,
+                    uint64_t* const last_sequence = nullptr) {
+    static_assert(kChangeLogSupported,
+                  "Change logs require trivially copyable elements");
+    using EventType = typename ChangeLogType::EventType;
+    return ChangeLogType::ReadEvents(
+        log_dir, after_sequence,
+        [this](const auto, const EventType type, const KeyValueType* const kv,
+               const KeyType* const key) {
+          switch (type) {
+            case EventType::kInsert:
+            case EventType::kUpdate: {
+              auto [it, inserted] = Insert(*kv);
+              if constexpr (!std::is_same_v<Value, VoidValue>) {
+                if (!inserted) UpdateValue(it, kv->second);
+              }
+              break;
+            }
+            case EventType::kErase:
+              Erase(*key);
+              break;
+            case EventType::kClear:
+              Clear();
+              break;
+          }
+        },
+        last_sequence);
+  }
+
  private:
   inline static constexpr float pCleanseMaxLoadFactor(
       const float max_load_factor) {
@@ -487,55 +999,136 @@ class PerrohtImpl {
                     std::min(max_load_factor, 1.0f));
   }
 
-  inline static SizeType pGetMemorySize(const SizeType capacity) {
-    return (sizeof(Header) + sizeof(DataHolderType)) * capacity;
+  inline static constexpr SizeType pGetMemorySize(const SizeType capacity) {
+    return LayoutOffsets::MemorySize(capacity);
+  }
+
+  /// Return the offset of the header at the given position in a table.
+  inline static constexpr SizeType pHeaderOffset(const SizeType pos) {
+    return LayoutOffsets::HeaderOffset(pos);
+  }
+
+  /// Return the offset of the data at the given position in a table.
+  inline static constexpr SizeType pDataOffset(const SizeType capacity,
+                                               const SizeType pos) {
+    return LayoutOffsets::DataOffset(capacity, pos);
+  }
+
+  /// Return the offset of the key at the given position in the key array.
+  /// Only meaningful if kKeyArray is true.
+  inline static constexpr SizeType pKeyOffset(const SizeType capacity,
+                                              const SizeType pos) {
+    return LayoutOffsets::KeyOffset(capacity, pos);
   }
 
   inline static Header& pGetHeader(BytePointer table, const SizeType pos) {
-#ifdef PERROHT_SEPARATE_HEADER
-    return *reinterpret_cast<Header*>(ToAddress(table) + pos * sizeof(Header));
-#else
-    return *reinterpret_cast<Header*>(ToAddress(table) + pGetMemorySize(pos));
-#endif
+    return *reinterpret_cast<Header*>(ToAddress(table) + pHeaderOffset(pos));
   }
 
   inline static const Header& pGetHeader(ConstBytePointer table,
                                          const SizeType pos) {
-#ifdef PERROHT_SEPARATE_HEADER
     return *reinterpret_cast<const Header*>(ToAddress(table) +
-                                            pos * sizeof(Header));
-#else
-    return *reinterpret_cast<const Header*>(ToAddress(table) +
-                                            pGetMemorySize(pos));
-#endif
+                                            pHeaderOffset(pos));
   }
 
-  inline static DataHolderType& pGetData(
-      BytePointer table, [[maybe_unused]] const SizeType capacity,
-      const SizeType pos) {
-#ifdef PERROHT_SEPARATE_HEADER
+  inline static DataHolderType& pGetData(BytePointer table,
+                                         const SizeType capacity,
+                                         const SizeType pos) {
     return *reinterpret_cast<DataHolderType*>(ToAddress(table) +
-                                              capacity * sizeof(Header) +
-                                              pos * sizeof(DataHolderType));
-#else
-    return *reinterpret_cast<DataHolderType*>(
-        ToAddress(table) + pGetMemorySize(pos) + sizeof(Header));
-#endif
-  }
-
-  inline static const DataHolderType& pGetData(
-      ConstBytePointer table, [[maybe_unused]] const SizeType capacity,
-      const SizeType pos) {
-#ifdef PERROHT_SEPARATE_HEADER
-    return *reinterpret_cast<const DataHolderType*>(
-        ToAddress(table) + capacity * sizeof(Header) +
-        pos * sizeof(DataHolderType));
-#else
+                                              pDataOffset(capacity, pos));
+  }
+
+  inline static const DataHolderType& pGetData(ConstBytePointer table,
+                                               const SizeType capacity,
+                                               const SizeType pos) {
+    return *reinterpret_cast<const DataHolderType*>(ToAddress(table) +
+                                                    pDataOffset(capacity, pos));
+  }
+
+  /// Raw pointer versions of pGetHeader() and pGetData(), for a table whose
+  /// address has been resolved by ToAddress() already.
+  inline static Header& pRawHeader(std::byte* const table,
+                                   const SizeType pos) {
+    return *reinterpret_cast<Header*>(table + pHeaderOffset(pos));
+  }
+
+  inline static const Header& pRawHeader(const std::byte* const table,
+                                         const SizeType pos) {
+    return *reinterpret_cast<const Header*>(table + pHeaderOffset(pos));
+  }
+
+  inline static DataHolderType& pRawData(std::byte* const table,
+                                         const SizeType capacity,
+                                         const SizeType pos) {
+    return *reinterpret_cast<DataHolderType*>(table +
+                                              pDataOffset(capacity, pos));
+  }
+
+  inline static const DataHolderType& pRawData(const std::byte* const table,
+                                               const SizeType capacity,
+                                               const SizeType pos) {
     return *reinterpret_cast<const DataHolderType*>(
-        ToAddress(table) + pGetMemorySize(pos) + sizeof(Header));
-#endif
+        table + pDataOffset(capacity, pos));
+  }
+
+  /// Return the key of the entry at the given position, reading it from the
+  /// key array if there is one.
+  inline static const KeyType& pRawKey(const std::byte* const table,
+                                       const SizeType capacity,
+                                       const SizeType pos) {
+    if constexpr (kKeyArray) {
+      return *reinterpret_cast<const KeyType*>(table +
+                                               pKeyOffset(capacity, pos));
+    } else {
+      return KVTraits::GetKey(pRawData(table, capacity, pos).Get());
+    }
+  }
+
+  /// Copy the key of the entry at the given position to the key array.
+  /// Must be called every time an entry is placed at a position.
+  /// Does nothing if there is no key array.
+  inline static void pStoreKey([[maybe_unused]] BytePointer table,
+                               [[maybe_unused]] const SizeType capacity,
+                               [[maybe_unused]] const SizeType pos) {
+    if constexpr (kKeyArray) {
+      new (ToAddress(table) + pKeyOffset(capacity, pos))
+          KeyType(KVTraits::GetKey(pGetData(table, capacity, pos).Get()));
+    }
+  }
+
+  inline void pStoreKey(const SizeType pos) {
+    pStoreKey(table_, Capacity(), pos);
+  }
+
+  /// Return the i-th data holder in the overflow stash.
+  inline DataHolderType& pGetStashData(const SizeType i) {
+    return reinterpret_cast<DataHolderType*>(ToAddress(pFindSide()->stash))[i];
+  }
+
+  inline const DataHolderType& pGetStashData(const SizeType i) const {
+    return reinterpret_cast<const DataHolderType*>(
+        ToAddress(pFindSide()->stash))[i];
+  }
+
+  /// Return the number of elements in the overflow stash.
+  inline SizeType pStashSize() const noexcept {
+    const auto* const side = pFindSide();
+    return side ? side->stash_size : 0;
+  }
+
+  /// Return the data holder at the given position. Positions from
+  /// Capacity() on refer to the stash.
+  inline DataHolderType& pGetEntry(const SizeType pos) {
+    return pos < Capacity() ? pGetData(pos) : pGetStashData(pos - Capacity());
   }
 
+  inline const DataHolderType& pGetEntry(const SizeType pos) const {
+    return pos < Capacity() ? pGetData(pos) : pGetStashData(pos - Capacity());
+  }
+
+  /// Return the position next to the last stashed element.
+  inline SizeType pEndPosition() const { return Capacity() + pStashSize(); }
+
   inline SizeType pGetRequiredCapacity(const SizeType size) const {
     return std::max(size, SizeType(std::ceil(size / MaxLoadFactor())));
   }
@@ -562,6 +1155,42 @@ class PerrohtImpl {
     assert(false);
   }
 
+  /// Return the fingerprint of the given hash value, which is kept with a
+  /// tagged node pointer. The hash is mixed first, as its lower bits also
+  /// select the position and some hash functions, e.g., std::hash for
+  /// integers, leave the upper bits zero.
+  inline static uint8_t pFingerprint(const std::size_t hash) {
+    return uint8_t((uint64_t(hash) * 0x9E3779B97F4A7C15ULL) >> 56);
+  }
+
+  /// Store the fingerprint of the key in the data if node pointers are
+  /// tagged. Must be called before new data is placed in a table.
+  inline void pSetFingerprint([[maybe_unused]] DataHolderType& data,
+                              [[maybe_unused]] const std::size_t hash) const {
+    if constexpr (kTaggedNode) {
+      data.SetFingerprint(pFingerprint(hash));
+    }
+  }
+
+  inline void pSetFingerprint(DataHolderType& data) const {
+    if constexpr (kTaggedNode) {
+      pSetFingerprint(data, hasher_(KVTraits::GetKey(data.Get())));
+    }
+  }
+
+  /// Return false if the entry at the given position cannot hold a key with
+  /// the given fingerprint. Always true unless node pointers are tagged.
+  inline static bool pMayMatch([[maybe_unused]] const std::byte* const table,
+                               [[maybe_unused]] const SizeType capacity,
+                               [[maybe_unused]] const SizeType pos,
+                               [[maybe_unused]] const uint8_t fingerprint) {
+    if constexpr (kTaggedNode) {
+      return pRawData(table, capacity, pos).Fingerprint() == fingerprint;
+    } else {
+      return true;
+    }
+  }
+
   inline SizeType pDecrementPosition(const SizeType pos) const {
     if constexpr (std::is_same_v<CapacityAlgo, PowerOfTwoCapacity>) {
       assert(Capacity() > 0);
@@ -626,6 +1255,16 @@ class PerrohtImpl {
         (mean_probe_distance_ * current_size + d) / (current_size + 1);
   }
 
+  /// Remove the distance d of an element that is no longer counted from the
+  /// mean; current_size still counts the element.
+  inline void pUpdateMeanProbeDistanceWithoutDistance(
+      const SizeType d, const SizeType current_size) {
+    mean_probe_distance_ =
+        current_size <= 1
+            ? 0
+            : (mean_probe_distance_ * current_size - d) / (current_size - 1);
+  }
+
   inline void pUpdateMeanProbeDistance(const SizeType old_d,
                                        const SizeType new_d,
                                        const SizeType size) {
@@ -638,6 +1277,11 @@ class PerrohtImpl {
     assert(Capacity() == 0);
     assert(table_ == nullptr);
 
+    if (pCopyTableImageFrom(other)) {
+      pCopyStashFrom(other);
+      return;
+    }
+
     table_ = pAllocateTable(other.Capacity());
     capacity_index_ = other.capacity_index_;
     mean_probe_distance_ = other.mean_probe_distance_;
@@ -651,8 +1295,36 @@ class PerrohtImpl {
       pGetHeader(i) = oh;
       DataHolderType::ConstructInPlace(allocator_, &pGetData(i),
                                        other.pGetData(i).Get());
+      pSetFingerprint(pGetData(i));
+      pStoreKey(i);
       ++size_;
     }
+    pCopyStashFrom(other);
+    pResetDirtyPages(true);
+  }
+
+  /// Copy the stashed elements of other after its table has been copied.
+  void pCopyStashFrom(const SelfType& other) {
+    for (SizeType i = 0; i < other.pStashSize(); ++i) {
+      pForceInsert(pConstructDataHolder(other.pGetStashData(i).Get()));
+    }
+  }
+
+  /// Move the stashed elements of other after its table has been moved and
+  /// release other's stash.
+  template <typename Other>
+  void pTakeStashFrom(Other& other) {
+    auto* const side = other.pFindSide();
+    if (!side) {
+      return;
+    }
+    for (SizeType i = 0; i < side->stash_size; ++i) {
+      auto& data = other.pGetStashData(i);
+      pForceInsert(pConstructDataHolder(std::move(data.Get())));
+      data.Clear(other.allocator_);
+    }
+    side->stash_size = 0;
+    other.pFreeStash();
   }
 
   // \warning This function clean up the old table. Therefore,
@@ -663,6 +1335,12 @@ class PerrohtImpl {
     assert(Capacity() == 0);
     assert(table_ == nullptr);
 
+    if (pCopyTableImageFrom(other)) {
+      pTakeStashFrom(other);
+      other.pFreeTable();
+      return;
+    }
+
     table_ = pAllocateTable(other.Capacity());
     capacity_index_ = other.capacity_index_;
     mean_probe_distance_ = other.mean_probe_distance_;
@@ -676,43 +1354,217 @@ class PerrohtImpl {
       pGetHeader(i) = std::move(oh);
       DataHolderType::ConstructInPlace(allocator_, &pGetData(i),
                                        std::move(other.pGetData(i).Get()));
+      pSetFingerprint(pGetData(i));
+      pStoreKey(i);
       ++size_;
     }
+    pTakeStashFrom(other);
     other.pFreeTable();
+    pResetDirtyPages(true);
   }
 
-  /// Locate the entry for the given key.
-  /// If multiple entries are found, return the first one.
-  /// If no entry is found, return the position where the entry should be
-  /// inserted.
-  std::pair<SizeType, bool> pLocate(const KeyType& key) const {
-    if (Capacity() == 0) {
-      return {Capacity(), false};  // not found
-    }
-
-    auto pos = pIdealPosition(key);
-
-    for (SizeType dist = 0; dist < Capacity(); ++dist) {
-      const auto& h = pGetHeader(pos);
-      if (h.Empty() || pGetProbeDistance(pos) < dist) {
-        break;  // not found
+  /// Duplicate the table of other with a single memcpy of the table image,
+  /// headers included. Returns false if the entries are not bitwise copyable
+  /// or the table could not be allocated.
+  bool pCopyTableImageFrom(const SelfType& other) {
+    if constexpr (kBitwiseCopyableTable) {
+      if (other.Capacity() == 0) {
+        return false;
       }
-
-      if (key_equal_(KVTraits::GetKey(pGetData(pos).Get()), key)) {
-        return {pos, true};  // found
+      const auto size = pGetMemorySize(other.Capacity());
+      ByteAllocator alloc(GetAllocator());
+      BytePointer table = AllocTraits<ByteAllocator>::allocate(alloc, size);
+      if (!table) {
+        return false;
       }
-
-      pos = pIncrementPosition(pos);
+      std::memcpy(ToAddress(table), ToAddress(other.table_), size);
+      table_ = table;
+      capacity_index_ = other.capacity_index_;
+      size_ = other.size_;
+      mean_probe_distance_ = other.mean_probe_distance_;
+      pResetDirtyPages(true);
+      return true;
+    } else {
+      return false;
     }
-
-    return {pos, false};  // not found
   }
 
-  /// Grow the table by kGrowFactor even there is an enough capacity already.
-  void pGrow(const SizeType min_required_size) {
-    auto new_capacity_index = capacity_index_ + 1;
+  /// Move the entries of a container that uses another allocator type into
+  /// a new table of the same capacity; the entries stay at their positions.
+  /// The table image is copied in bulk if the entries are bitwise copyable;
+  /// otherwise, entries (or nodes) are relocated one by one.
+  /// The source table is processed in chunks of kMigrationChunkSize bytes.
+  /// If the source allocator can discard pages (see DiscardPages()), the
+  /// memory of each chunk is given back to the OS once it has been migrated,
+  /// so that the source and the new table do not coexist in full.
+  template <typename Other>
+  void pMigrateEntriesFrom(Other& other) {
+    assert(Size() == 0);
+    assert(table_ == nullptr);
+    const auto capacity = other.Capacity();
+    if (capacity == 0) {
+      return;
+    }
 
-    // Make sure that the new capacity is enough to hold the elements.
+    BytePointer table = nullptr;
+    if constexpr (kBitwiseCopyableTable) {
+      ByteAllocator alloc(GetAllocator());
+      table = AllocTraits<ByteAllocator>::allocate(alloc,
+                                                   pGetMemorySize(capacity));
+    } else {
+      table = pAllocateTable(capacity);
+    }
+    if (!table) {
+      assert(false);
+      std::abort();
+    }
+    table_ = table;
+    capacity_index_ = other.capacity_index_;
+    mean_probe_distance_ = other.mean_probe_distance_;
+
+    // A snapshot of the source keeps reading the source table.
+    const bool discard = HasDiscardPages<typename Other::Allocator>::value &&
+                         !other.pSnapshot();
+    if constexpr (kBitwiseCopyableTable) {
+      auto* const dst = ToAddress(table_);
+      auto* const src = ToAddress(other.table_);
+      const auto length = pGetMemorySize(capacity);
+      for (SizeType offset = 0; offset < length;
+           offset += kMigrationChunkSize) {
+        const auto chunk = std::min(kMigrationChunkSize, length - offset);
+        std::memcpy(dst + offset, src + offset, chunk);
+        if (discard) {
+          DiscardPages(other.allocator_, src + offset, chunk);
+        }
+      }
+      size_ = other.size_;
+    } else {
+      // Keep chunks a multiple of kGroupSize so that whole blocks are
+      // discarded.
+      const auto chunk =
+          std::max(SizeType(1),
+                   kMigrationChunkSize / pGetMemorySize(kGroupSize)) *
+          kGroupSize;
+      for (SizeType begin = 0; begin < capacity; begin += chunk) {
+        const auto end = std::min(capacity, begin + chunk);
+        for (auto i = begin; i < end; ++i) {
+          if (other.pGetHeader(i).Empty()) {
+            continue;
+          }
+          pGetHeader(i) = other.pGetHeader(i);
+          DataHolderType::ConstructInPlace(
+              allocator_, &pGetData(i), std::move(other.pGetData(i).Get()));
+          pSetFingerprint(pGetData(i));
+          pStoreKey(i);
+          other.pGetData(i).Clear(other.allocator_);
+          ++size_;
+        }
+        if (discard) {
+          other.pDiscardPositions(begin, end);
+        }
+      }
+    }
+
+    pTakeStashFrom(other);
+
+    // The entries of the source have been moved out or were trivially
+    // destructible; release its table without touching it.
+    other.size_ = 0;
+    other.mean_probe_distance_ = 0;
+    other.pFreeDirtyPages();
+    other.pReleaseTable(other.table_, capacity);
+    other.capacity_index_ = 0;
+    other.table_ = nullptr;
+    pResetDirtyPages(true);
+  }
+
+  /// Give the memory of the positions in [begin, end) back to the OS if the
+  /// allocator supports it (see DiscardPages()).
+  /// The entries in the range must have been destroyed; the range must not
+  /// be read again.
+  void pDiscardPositions(const SizeType begin, const SizeType end) {
+    if constexpr (kSeparateHeader) {
+      DiscardPages(allocator_, &pGetHeader(begin),
+                   (end - begin) * sizeof(Header));
+      if constexpr (kKeyArray) {
+        DiscardPages(allocator_,
+                     ToAddress(table_) + pKeyOffset(Capacity(), begin),
+                     (end - begin) * sizeof(KeyType));
+      }
+      DiscardPages(allocator_, &pGetData(begin),
+                   (end - begin) * sizeof(DataHolderType));
+    } else {
+      // Only whole blocks can be discarded.
+      const auto first = (begin + kGroupSize - 1) / kGroupSize * kGroupSize;
+      const auto last = end / kGroupSize * kGroupSize;
+      if (first < last) {
+        DiscardPages(allocator_, ToAddress(table_) + pGetMemorySize(first),
+                     pGetMemorySize(last - first));
+      }
+    }
+  }
+
+  /// Locate the entry for the given key.
+  /// If multiple entries are found, return the first one.
+  /// If no entry is found, return the position where the entry should be
+  /// inserted.
+  std::pair<SizeType, bool> pLocate(const KeyType& key) const {
+    // Resolve the table address once instead of at every probe, which is
+    // not free if the allocator uses fancy pointers, e.g., offset pointers.
+    return pLocateIn(ToAddress(table_), Capacity(), key);
+  }
+
+  /// pLocate() for a table whose address has been resolved already.
+  std::pair<SizeType, bool> pLocateIn(const std::byte* const table,
+                                      const SizeType capacity,
+                                      const KeyType& key) const {
+    static_assert(std::is_same_v<CapacityAlgo, PowerOfTwoCapacity>);
+    if (capacity == 0) {
+      return {capacity, false};  // not found
+    }
+
+    const auto mask = capacity - 1;
+    const auto hash = hasher_(key);
+    [[maybe_unused]] const auto fingerprint = pFingerprint(hash);
+    auto pos = hash & mask;
+
+    for (SizeType dist = 0; dist < capacity; ++dist) {
+      const auto& h = pRawHeader(table, pos);
+      if (h.Empty()) {
+        break;  // not found
+      }
+
+      const auto& stored_key = pRawKey(table, capacity, pos);
+      // Recalculate the probe distance if it was too long to be stored.
+      const SizeType pd = h.GetProbeDistance() < Header::MaxProbeDistance()
+                              ? h.GetProbeDistance()
+                              : (pos - hasher_(stored_key)) & mask;
+      if (pd < dist) {
+        break;  // not found
+      }
+
+      if (pMayMatch(table, capacity, pos, fingerprint) &&
+          key_equal_(stored_key, key)) {
+        return {pos, true};  // found
+      }
+
+      pos = (pos + 1) & mask;
+    }
+
+    for (SizeType i = 0; i < pStashSize(); ++i) {
+      if (key_equal_(KVTraits::GetKey(pGetStashData(i).Get()), key)) {
+        return {capacity + i, true};  // found in the stash
+      }
+    }
+
+    return {pos, false};  // not found
+  }
+
+  /// Grow the table by kGrowFactor even there is an enough capacity already.
+  void pGrow(const SizeType min_required_size) {
+    auto new_capacity_index = capacity_index_ + 1;
+
+    // Make sure that the new capacity is enough to hold the elements.
     while (!pEnoughCapacity(min_required_size,
                             CapacityAlgo::ToCapacity(new_capacity_index))) {
       ++new_capacity_index;
@@ -721,8 +1573,14 @@ class PerrohtImpl {
   }
 
   void pInitTable(BytePointer table, const SizeType capacity) {
+    pInitHeaders(table, 0, capacity);
+  }
+
+  /// Make the positions in [begin, end) of a table empty.
+  void pInitHeaders(BytePointer table, const SizeType begin,
+                    const SizeType end) {
     HeaderAllocator alloc(GetAllocator());
-    for (SizeType i = 0; i < capacity; ++i) {
+    for (SizeType i = begin; i < end; ++i) {
       AllocTraits<HeaderAllocator>::construct(alloc, &pGetHeader(table, i));
       pGetHeader(table, i).Clear();
     }
@@ -730,7 +1588,7 @@ class PerrohtImpl {
 
   /// Allocate and initialize a new table.
   BytePointer pAllocateTable(const SizeType capacity) {
-    const auto size = (sizeof(Header) + sizeof(DataHolderType)) * capacity;
+    const auto size = pGetMemorySize(capacity);
     ByteAllocator alloc(GetAllocator());
     BytePointer table = AllocTraits<ByteAllocator>::allocate(alloc, size);
     if (!table) {
@@ -741,10 +1599,10 @@ class PerrohtImpl {
   }
 
   bool pDeallocateTable(BytePointer table, const SizeType capacity) {
-    if (!table || capacity == 0) {
+    if (!table) {
       return true;
     }
-    const auto size = (sizeof(Header) + sizeof(DataHolderType)) * capacity;
+    const auto size = pGetMemorySize(capacity);
     ByteAllocator alloc(GetAllocator());
     AllocTraits<ByteAllocator>::deallocate(alloc, table, size);
     return true;
@@ -756,12 +1614,46 @@ class PerrohtImpl {
     }
     size_ = 0;
     mean_probe_distance_ = 0;
+    pClearStash();
+  }
+
+  void pClearStash() {
+    auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    for (SizeType i = 0; i < side->stash_size; ++i) {
+      pGetStashData(i).Clear(allocator_);
+    }
+    side->stash_size = 0;
+  }
+
+  /// Destroy the stashed elements and deallocate the stash.
+  void pFreeStash() noexcept {
+    pClearStash();
+    auto* const side = pFindSide();
+    if (side && side->stash) {
+      ByteAllocator alloc(GetAllocator());
+      AllocTraits<ByteAllocator>::deallocate(
+          alloc, side->stash, kStashCapacity * sizeof(DataHolderType));
+      side->stash = nullptr;
+    }
   }
 
   /// Destroy and deallocate a table.
   void pFreeTable() noexcept {
-    pClearAll();
-    pDeallocateTable(table_, Capacity());
+    if (pSnapshot() || kBitwiseCopyableTable) {
+      // Elements are trivially destructible when they are bitwise copyable,
+      // which is also the case when a snapshot exists.
+      // Leave the table intact for the snapshot.
+      size_ = 0;
+      mean_probe_distance_ = 0;
+    } else {
+      pClearAll();
+    }
+    pFreeStash();
+    pFreeDirtyPages();
+    pReleaseTable(table_, Capacity());
     capacity_index_ = 0;
     table_ = nullptr;
   }
@@ -773,12 +1665,28 @@ class PerrohtImpl {
     assert(new_capacity == CapacityAlgo::AdjustCapacity(new_capacity) &&
            "Capacity must match one of the valid capacities");
 
+    if constexpr (kShallowCopyableEntry) {
+      if (Capacity() > 0) {
+        return pRelocateEntriesTo(std::move(new_table), new_capacity);
+      }
+    }
+
+    // Entries are moved out of the old table destructively, so an
+    // interrupted transfer cannot be rolled back. Record it so that Recover()
+    // reports the failure. A transfer started by an insertion below (see
+    // pAutoGrow()) is covered by the outer one.
+    const bool record_move = Capacity() > 0 && pResizeIdle();
+    if (record_move) {
+      pGetSide().resize.BeginMove();
+    }
+
     using std::swap;
     swap(table_, new_table);
     const auto old_capacity = CapacityAlgo::ToCapacity(capacity_index_);
     capacity_index_ = CapacityAlgo::ToIndex(new_capacity);
     size_ = 0;
     mean_probe_distance_ = 0;
+    pResetDirtyPages(true);
 
     prhdtls::os_madvise(ToAddress(table_), pGetMemorySize(new_capacity),
                         MADV_RANDOM);
@@ -787,23 +1695,796 @@ class PerrohtImpl {
     // Rename it to old_table to avoid confusion.
     auto old_table = new_table;
     if (old_capacity == 0) {
+      pDeallocateTable(old_table, old_capacity);
+      return true;
+    }
+
+    prhdtls::os_madvise(ToAddress(old_table), pGetMemorySize(old_capacity),
+                        MADV_SEQUENTIAL);
+
+    if (new_capacity >= old_capacity) {
+      pStreamEntriesFrom(old_table, old_capacity, [&](const SizeType i) {
+        auto data = pMoveDataOut(pGetData(old_table, old_capacity, i));
+        pGetHeader(old_table, i).Clear();
+        return data;
+      });
+    } else {
+      for (SizeType i = 0; i < old_capacity; ++i) {
+        if (pGetHeader(old_table, i).Empty()) {
+          continue;
+        }
+        pInsert(check_capacity,
+                pMoveDataOut(pGetData(old_table, old_capacity, i)));
+        pGetHeader(old_table, i).Clear();
+      }
+    }
+
+    pDeallocateTable(old_table, old_capacity);
+    if (record_move) {
+      pGetSide().resize.Clear();
+      pReleaseIdleSide();
+    }
+    return true;
+  }
+
+  /// Crash-consistent version of pTransferEntriesTo().
+  /// The new table is built from shallow copies of the entries, leaving the
+  /// current table untouched until the new one is committed in the resize
+  /// descriptor.
+  /// If the process dies before the commit, Recover() discards the new table;
+  /// otherwise, Recover() finishes the switch to the new table.
+  bool pRelocateEntriesTo(BytePointer new_table, const SizeType new_capacity) {
+    assert(Capacity() > 0);
+    assert(pEnoughCapacity(Size(), new_capacity));
+    const auto new_capacity_index = CapacityAlgo::ToIndex(new_capacity);
+    auto& resize = pGetSide().resize;
+    resize.Begin(table_, capacity_index_, new_table, new_capacity_index);
+
+    prhdtls::os_madvise(ToAddress(new_table), pGetMemorySize(new_capacity),
+                        MADV_RANDOM);
+    prhdtls::os_madvise(ToAddress(table_), pGetMemorySize(Capacity()),
+                        MADV_SEQUENTIAL);
+
+    // Build the new table through a staging container that shares this
+    // container's functors and allocator.
+    SelfType staging(0, max_load_factor_, hasher_, key_equal_, allocator_);
+    staging.table_ = new_table;
+    staging.capacity_index_ = new_capacity_index;
+    if (new_capacity >= Capacity()) {
+      staging.pStreamEntriesFrom(table_, Capacity(), [&](const SizeType i) {
+        return DataHolderType::MakeShallowCopy(allocator_, pGetData(i));
+      });
+    } else {
+      for (SizeType i = 0; i < Capacity(); ++i) {
+        if (pGetHeader(i).Empty()) {
+          continue;
+        }
+        staging.pForceInsert(
+            DataHolderType::MakeShallowCopy(allocator_, pGetData(i)));
+      }
+    }
+    resize.Commit(staging.size_, staging.mean_probe_distance_);
+
+    // The new table is owned by this container from here on.
+    staging.size_ = 0;
+    staging.capacity_index_ = 0;
+    staging.table_ = nullptr;
+
+    pFinishResize();
+    return true;
+  }
+
+  /// Switch to the new table recorded in the resize descriptor and
+  /// deallocate the old one.
+  /// The entries in the old table are not destroyed as the new table holds
+  /// their shallow copies. Can be called again if it was interrupted.
+  void pFinishResize() {
+    auto& resize = pGetSide().resize;
+    table_ = resize.NewTable();
+    capacity_index_ = resize.NewCapacityIndex();
+    size_ = resize.NewSize();
+    mean_probe_distance_ = resize.NewMeanProbeDistance();
+
+    const auto old_capacity =
+        CapacityAlgo::ToCapacity(resize.OldCapacityIndex());
+    pReleaseTable(resize.ReleaseOldTable(), old_capacity);
+    resize.Clear();
+    pResetDirtyPages(true);
+    pReleaseIdleSide();
+  }
+
+  /// Finish or roll back an interrupted resize. See Recover().
+  bool pRecoverResize() {
+    using Phase = typename ResizeDescriptorType::Phase;
+    auto* const side = pFindSide();
+    if (!side) {
+      return true;
+    }
+    auto& resize = side->resize;
+    switch (resize.GetPhase()) {
+      case Phase::kIdle:
+        return true;
+
+      case Phase::kMigrating: {
+        // Only recorded by pRelocateEntriesTo(). The new table only holds
+        // shallow copies of the entries in the current table. Discard it
+        // without destroying the entries.
+        const auto new_capacity =
+            CapacityAlgo::ToCapacity(resize.NewCapacityIndex());
+        pDeallocateTable(resize.ReleaseNewTable(), new_capacity);
+        resize.Clear();
+        return true;
+      }
+
+      case Phase::kCommitted:
+        pFinishResize();
+        return true;
+
+      case Phase::kInPlace:
+        // Entries were being moved within the table.
+        return false;
+
+      case Phase::kMoving:
+        // Entries were being moved out of the old table.
+        return false;
+    }
+    return false;
+  }
+
+  /// Insert the entries of another table into this container's table, which
+  /// must be empty and at least as large, in a single sequential pass.
+  /// take(i) must return the entry at position i of the other table.
+  /// Robin Hood hashing keeps the entries sorted by their ideal positions, and
+  /// with power-of-two capacities the new ideal position of an entry whose old
+  /// ideal position is i is i + k * old_capacity for some k. Thus, taking the
+  /// entries in position order fills each of the new_capacity / old_capacity
+  /// parts of the new table as a sequential stream: every entry goes to the
+  /// first free position at or after its ideal one, with neither swaps nor
+  /// probe distance comparisons. The entries that wrapped around the end of
+  /// the other table break the order; they are inserted last in the usual way.
+  template <typename Take>
+  void pStreamEntriesFrom(BytePointer old_table, const SizeType old_capacity,
+                          Take&& take) {
+    static_assert(std::is_same_v<CapacityAlgo, PowerOfTwoCapacity>,
+                  "Streaming relies on power-of-two capacities");
+    assert(size_ == 0);
+    assert(Capacity() >= old_capacity);
+
+    SizeType num_wrapped = 0;
+    while (num_wrapped < old_capacity &&
+           !pGetHeader(old_table, num_wrapped).Empty()) {
+      const auto& key = KVTraits::GetKey(
+          pGetData(old_table, old_capacity, num_wrapped).Get());
+      if ((hasher_(key) & (old_capacity - 1)) <= num_wrapped) {
+        break;
+      }
+      ++num_wrapped;
+    }
+
+    prhdtls::os_madvise(ToAddress(table_), pGetMemorySize(Capacity()),
+                        MADV_SEQUENTIAL);
+    for (auto i = num_wrapped; i < old_capacity; ++i) {
+      if (!pGetHeader(old_table, i).Empty()) {
+        pAppendInOrder(take(i));
+      }
+    }
+    for (SizeType i = 0; i < num_wrapped; ++i) {
+      pForceInsert(take(i));
+    }
+    prhdtls::os_madvise(ToAddress(table_), pGetMemorySize(Capacity()),
+                        MADV_RANDOM);
+  }
+
+  /// Place an entry at the first free position at or after its ideal
+  /// position. The entries placed before it in the same run must not have
+  /// larger ideal positions (see pStreamEntriesFrom()), so that the Robin
+  /// Hood order holds without moving them.
+  void pAppendInOrder(DataHolderType&& data) {
+    auto pos = pIdealPosition(KVTraits::GetKey(data.Get()));
+    SizeType dist = 0;
+    while (!pGetHeader(pos).Empty()) {
+      pos = pIncrementPosition(pos);
+      ++dist;
+    }
+    pBeforeWrite(pos);
+    pSetProbeDistance(pos, dist);
+    pUpdateMeanProbeDistanceWithNewDistance(dist, size_);
+    pMoveDataInto(pGetData(pos), data);
+    pStoreKey(pos);
+    ++size_;
+  }
+
+  /// Resize the table in place if it is enabled and possible.
+  /// Returns false, leaving the table untouched, otherwise.
+  bool pResizeInPlace(const SizeType new_capacity) {
+    static_assert(std::is_same_v<CapacityAlgo, PowerOfTwoCapacity>,
+                  "In-place resizing relies on power-of-two capacities");
+    if (!ResizingInPlace() || pSnapshot() || !pResizeIdle() ||
+        Capacity() == 0 || new_capacity == Capacity()) {
+      return false;
+    }
+    if (new_capacity > Capacity()) {
+      return pGrowInPlace(new_capacity);
+    }
+    return pShrinkInPlace(new_capacity);
+  }
+
+  /// Extend the allocation of the table and redistribute the entries.
+  bool pGrowInPlace(const SizeType new_capacity) {
+    const auto old_capacity = Capacity();
+    ByteAllocator alloc(GetAllocator());
+    if (!ExpandInPlace(alloc, table_, pGetMemorySize(old_capacity),
+                       pGetMemorySize(new_capacity))) {
+      return false;
+    }
+    auto& resize = pGetSide().resize;
+    resize.BeginInPlace();
+    pFreeDirtyPages();
+    pSpreadEntries(old_capacity, new_capacity);
+    resize.Clear();
+    pResetDirtyPages(true);
+    return true;
+  }
+
+  /// Redistribute the entries of a table of old_capacity over the first
+  /// new_capacity positions of the same allocation, in a single pass.
+  /// With power-of-two capacities, the new ideal position of an entry whose
+  /// old ideal position is i is i + k * old_capacity for some k.
+  /// Thus, taking the entries out in position order and inserting them again
+  /// never touches a position that has not been processed yet: an entry lands
+  /// at or before its old position in its k-th part of the new table.
+  /// The only exception is the entries that wrapped around the end of the old
+  /// table; they are set aside first and inserted at the end.
+  /// See also pStreamEntriesFrom().
+  void pSpreadEntries(const SizeType old_capacity,
+                      const SizeType new_capacity) {
+    if constexpr (kSeparateHeader) {
+      // The data holders follow the headers; move them to their new offsets,
+      // starting from the last one so that no holder is overwritten.
+      for (SizeType i = old_capacity; i-- > 0;) {
+        if (!pGetHeader(i).Empty()) {
+          pRelocateData(pGetData(table_, old_capacity, i),
+                        pGetData(table_, new_capacity, i));
+        }
+      }
+    }
+    pInitHeaders(table_, old_capacity, new_capacity);
+    capacity_index_ = CapacityAlgo::ToIndex(new_capacity);
+    size_ = 0;
+    mean_probe_distance_ = 0;
+
+    std::vector<DataHolderType> wrapped;
+    for (SizeType i = 0; i < old_capacity && !pGetHeader(i).Empty(); ++i) {
+      const auto& key = KVTraits::GetKey(pGetData(i).Get());
+      if ((hasher_(key) & (old_capacity - 1)) <= i) {
+        break;
+      }
+      wrapped.push_back(pTakeData(i));
+    }
+
+    for (SizeType i = 0; i < old_capacity; ++i) {
+      if (!pGetHeader(i).Empty()) {
+        pAppendInOrder(pTakeData(i));
+      }
+    }
+    for (auto& data : wrapped) {
+      pForceInsert(std::move(data));
+    }
+  }
+
+  /// Shrink the table in place.
+  /// The entries are packed at the end of the table first, which leaves the
+  /// beginning of the allocation free for the new table; then, they are
+  /// inserted into the new table and the tail of the allocation is released.
+  bool pShrinkInPlace(const SizeType new_capacity) {
+    if constexpr (!HasShrinkInPlace<ByteAllocator>::value) {
+      return false;
+    }
+    const auto old_capacity = Capacity();
+    assert(pEnoughCapacity(Size(), new_capacity));
+    auto& resize = pGetSide().resize;
+    resize.BeginInPlace();
+    pFreeDirtyPages();
+
+    auto first_packed = old_capacity;
+    for (SizeType i = old_capacity; i-- > 0;) {
+      if (pGetHeader(i).Empty()) {
+        continue;
+      }
+      --first_packed;
+      if (first_packed != i) {
+        pRelocateData(pGetData(i), pGetData(first_packed));
+      }
+    }
+
+    // Packed entries are beyond the new table in both layouts.
+    pInitHeaders(table_, 0, new_capacity);
+    capacity_index_ = CapacityAlgo::ToIndex(new_capacity);
+    size_ = 0;
+    mean_probe_distance_ = 0;
+    for (auto i = first_packed; i < old_capacity; ++i) {
+      pForceInsert(pMoveDataOut(pGetData(table_, old_capacity, i)));
+    }
+
+    ByteAllocator alloc(GetAllocator());
+    bool shrunk = ShrinkInPlace(alloc, table_, pGetMemorySize(old_capacity),
+                                pGetMemorySize(new_capacity));
+    if (!shrunk) {
+      // Move the new table to an allocation of the exact size.
+      auto new_table = pAllocateTable(new_capacity);
+      if (new_table) {
+        for (SizeType i = 0; i < new_capacity; ++i) {
+          if (pGetHeader(i).Empty()) {
+            continue;
+          }
+          pGetHeader(new_table, i) = pGetHeader(i);
+          pRelocateData(pGetData(i), pGetData(new_table, new_capacity, i));
+          pStoreKey(new_table, new_capacity, i);
+        }
+        pDeallocateTable(table_, old_capacity);
+        table_ = new_table;
+        shrunk = true;
+      } else {
+        // Go back to the capacity that matches the allocation.
+        pSpreadEntries(new_capacity, old_capacity);
+      }
+    }
+    resize.Clear();
+    pResetDirtyPages(true);
+    return shrunk;
+  }
+
+  /// Move the data at the given position out and make the position empty.
+  DataHolderType pTakeData(const SizeType pos) {
+    auto data = pMoveDataOut(pGetData(pos));
+    pGetHeader(pos).Clear();
+    return data;
+  }
+
+  /// Move the data out of a data holder in a table. The holder is left
+  /// uninitialized (destroyed or relocated); it must not be cleared.
+  DataHolderType pMoveDataOut(DataHolderType& src) {
+    if constexpr (kRelocatableEntry) {
+      DataHolderType data;
+      std::memcpy(static_cast<void*>(&data), &src, sizeof(DataHolderType));
+      return data;
+    } else {
+      DataHolderType data(std::move(src));
+      src.Clear(allocator_);
+      return data;
+    }
+  }
+
+  /// Move data to the uninitialized data holder dst in a table.
+  /// data must not be used afterward except for being destroyed.
+  inline static void pMoveDataInto(DataHolderType& dst,
+                                   DataHolderType& data) {
+    if constexpr (kRelocatableEntry) {
+      std::memcpy(static_cast<void*>(&dst), &data, sizeof(DataHolderType));
+    } else {
+      new (&dst) DataHolderType(std::move(data));
+    }
+  }
+
+  /// Exchange the data of two data holders.
+  inline static void pSwapData(DataHolderType& lhs, DataHolderType& rhs) {
+    if constexpr (kRelocatableEntry) {
+      alignas(DataHolderType) std::byte tmp[sizeof(DataHolderType)];
+      std::memcpy(tmp, &lhs, sizeof(DataHolderType));
+      std::memcpy(static_cast<void*>(&lhs), &rhs, sizeof(DataHolderType));
+      std::memcpy(static_cast<void*>(&rhs), tmp, sizeof(DataHolderType));
+    } else {
+      using std::swap;
+      swap(lhs, rhs);
+    }
+  }
+
+  /// Move the data holder at src to the uninitialized storage at dst.
+  /// The two may overlap.
+  void pRelocateData(DataHolderType& src, DataHolderType& dst) {
+    if constexpr (kRelocatableEntry) {
+      std::memmove(static_cast<void*>(&dst), &src, sizeof(DataHolderType));
+      return;
+    }
+    DataHolderType data(std::move(src));
+    src.Clear(allocator_);
+    new (&dst) DataHolderType(std::move(data));
+    data.Clear(allocator_);
+  }
+
+  /// Replay or discard the batch left in the redo log. See Recover().
+  bool pRecoverRedoLog() {
+    auto* const redo_log = pFindRedoLog();
+    if (!redo_log) {
+      return true;
+    }
+    switch (redo_log->GetState()) {
+      case RedoLogType::State::kEmpty:
+        return true;
+      case RedoLogType::State::kWriting:
+        return redo_log->Clear(allocator_);
+      case RedoLogType::State::kCommitted:
+        return pUndoBatch() && pReplayRedoLog();
+      case RedoLogType::State::kApplying:
+        // The batch was being applied without undo images.
+        return false;
+    }
+    return false;
+  }
+
+  /// Return the redo log, or nullptr if it has not been allocated.
+  inline RedoLogType* pFindRedoLog() const noexcept {
+    const auto* const side = pFindSide();
+    return side && side->redo_log ? ToAddress(side->redo_log) : nullptr;
+  }
+
+  /// Return the redo log, allocating it if it does not exist yet.
+  /// This container is flushed once the log is allocated so that Recover()
+  /// can find the log.
+  RedoLogType* pGetRedoLog() {
+    auto& side = pGetSide();
+    if (!side.redo_log) {
+      RedoLogAllocator alloc(allocator_);
+      RedoLogPointer redo_log =
+          AllocTraits<RedoLogAllocator>::allocate(alloc, 1);
+      if (!redo_log) {
+        return nullptr;
+      }
+      new (ToAddress(redo_log)) RedoLogType();
+      side.redo_log = redo_log;
+      std::vector<MemoryRange> ranges;
+      pAddHandleRanges(ranges);
+      if (!SyncMemoryRanges(ranges)) {
+        return nullptr;
+      }
+    }
+    return ToAddress(side.redo_log);
+  }
+
+  void pFreeRedoLog() noexcept {
+    auto* const side = pFindSide();
+    if (!side || !side->redo_log) {
+      return;
+    }
+    auto* const redo_log = ToAddress(side->redo_log);
+    redo_log->Free(allocator_);
+    redo_log->~RedoLogType();
+    RedoLogAllocator alloc(allocator_);
+    AllocTraits<RedoLogAllocator>::deallocate(alloc, side->redo_log, 1);
+    side->redo_log = nullptr;
+  }
+
+  /// Return true while a batch committed to the redo log is being applied.
+  inline bool pApplyingBatch() const {
+    const auto* const redo_log = pFindRedoLog();
+    if (!redo_log) {
+      return false;
+    }
+    const auto state = redo_log->GetState();
+    return state == RedoLogType::State::kCommitted ||
+           state == RedoLogType::State::kApplying;
+  }
+
+  /// Apply the committed batch in the redo log to the table and flush the
+  /// modified pages. The log is cleared only if they were flushed
+  /// successfully.
+  /// The undo images of the pages around the ideal positions of the keys in
+  /// the batch are taken and flushed at once beforehand. The pages that are
+  /// modified beyond them are saved one by one (see pBeforeWrite()).
+  bool pReplayRedoLog() {
+    auto* const redo_log = pFindRedoLog();
+    if (Capacity() > 0) {
+      if (!redo_log->BeginUndo(allocator_, ToAddress(table_),
+                               pGetMemorySize(Capacity()))) {
+        return false;
+      }
+      bool saved = true;
+      const auto save_run = [&](const KeyType& key) {
+        // An operation on key modifies the positions from the ideal one of
+        // the key up to the first empty one at most.
+        auto pos = pIdealPosition(key);
+        do {
+          saved &= pTakeUndoImages(pos);
+          if (pGetHeader(pos).Empty()) {
+            break;
+          }
+          pos = pIncrementPosition(pos);
+        } while (saved);
+      };
+      redo_log->Replay(
+          [&](const KeyValueType& kv) { save_run(KVTraits::GetKey(kv)); },
+          save_run);
+      if (!saved || (kBitwiseCopyableTable && !redo_log->FlushUndo())) {
+        return false;
+      }
+    }
+
+    redo_log->Replay([this](const KeyValueType& kv) { Insert(kv); },
+                     [this](const KeyType& key) { Erase(key); });
+    if (!pSyncBatch()) {
+      return false;
+    }
+    return redo_log->Clear(allocator_);
+  }
+
+  /// Copy the undo images in the redo log back to the table so that the
+  /// table is as it was before the batch, and flush the table.
+  bool pUndoBatch() {
+    auto* const redo_log = pFindRedoLog();
+    if (Capacity() > 0) {
+      redo_log->Undo(ToAddress(table_), pGetMemorySize(Capacity()));
+    }
+    size_ = redo_log->TableSize();
+    mean_probe_distance_ = redo_log->MeanProbeDistance();
+    if (!pSyncBatch()) {
+      return false;
+    }
+    return redo_log->ResetUndo(allocator_);
+  }
+
+  /// Record the pages that hold the entry at pos in the redo log, taking
+  /// their undo images if the table can be restored from them.
+  bool pTakeUndoImages(const SizeType pos) {
+    constexpr bool image = kBitwiseCopyableTable;
+    auto* const redo_log = pFindRedoLog();
+    auto* const region = ToAddress(table_);
+    const auto length = pGetMemorySize(Capacity());
+    bool ret =
+        redo_log->SaveUndo(allocator_, region, length, &pGetHeader(pos),
+                           sizeof(Header), image) &&
+        redo_log->SaveUndo(allocator_, region, length, &pGetData(pos),
+                           sizeof(DataHolderType), image);
+    if constexpr (kKeyArray) {
+      ret = ret && redo_log->SaveUndo(allocator_, region, length,
+                                      region + pKeyOffset(Capacity(), pos),
+                                      sizeof(KeyType), image);
+    }
+    return ret;
+  }
+
+  /// Flush the table pages recorded in the redo log, i.e., those modified by
+  /// the batch, the nodes referred to by them, and this container, which
+  /// holds the size of the table. The dirty pages are flushed too, if they
+  /// are tracked, as Sync() does.
+  bool pSyncBatch() {
+    std::vector<MemoryRange> ranges;
+    if (Capacity() > 0) {
+      ranges = pFindRedoLog()->UndoRanges(ToAddress(table_));
+      pAddNodeRanges(ranges);
+      const auto dirty_ranges = pTakeDirtyRanges();
+      ranges.insert(ranges.end(), dirty_ranges.begin(), dirty_ranges.end());
+    }
+    pAddHandleRanges(ranges);
+    CoalesceMemoryRanges(ranges);
+    return SyncMemoryRanges(ranges);
+  }
+
+  /// Add the pages of this container and of its side state, including the
+  /// stash and the nodes of the stashed elements.
+  void pAddHandleRanges(std::vector<MemoryRange>& ranges) const {
+    ranges.push_back(PageAlignedRange(this, sizeof(*this)));
+    const auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    ranges.push_back(PageAlignedRange(side, sizeof(SideState)));
+    if (side->stash) {
+      ranges.push_back(PageAlignedRange(
+          ToAddress(side->stash), kStashCapacity * sizeof(DataHolderType)));
+      if constexpr (!embed) {
+        for (SizeType i = 0; i < side->stash_size; ++i) {
+          ranges.push_back(PageAlignedRange(&pGetStashData(i).Get(),
+                                            sizeof(KeyValueType)));
+        }
+      }
+    }
+  }
+
+  /// Check the invariants of the entry at the given position.
+  bool pCheckEntry(const SizeType pos) const {
+    const auto& key = KVTraits::GetKey(pGetData(pos).Get());
+    if constexpr (kKeyArray) {
+      if (!key_equal_(pRawKey(ToAddress(table_), Capacity(), pos), key)) {
+        return false;
+      }
+    }
+    if (!pMayMatch(ToAddress(table_), Capacity(), pos,
+                   pFingerprint(hasher_(key)))) {
+      return false;
+    }
+    const auto dist = (pos + Capacity() - pIdealPosition(key)) % Capacity();
+    const auto stored_dist = pGetHeader(pos).GetProbeDistance();
+    if (stored_dist < Header::MaxProbeDistance()
+            ? stored_dist != dist
+            : dist < Header::MaxProbeDistance()) {
+      return false;
+    }
+
+    // There must not be any empty slot between the ideal position and pos,
+    // and probe distances increase by at most one per slot.
+    if (dist > 0) {
+      const auto prev = pDecrementPosition(pos);
+      if (pGetHeader(prev).Empty() || pGetProbeDistance(prev) + 1 < dist) {
+        return false;
+      }
+    }
+
+    // The first entry found by a lookup must be this one,
+    // i.e., there is no duplicate key before this entry.
+    const auto [found_pos, found] = pLocate(key);
+    return found && found_pos == pos;
+  }
+
+  /// Must be called before modifying the entry at the given position.
+  /// Records the dirty pages and copies the pages for the snapshot if needed.
+  inline void pBeforeWrite(const SizeType pos) {
+    auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    if (pApplyingBatch()) {
+      // The undo image of a page, if taken, must be durable before the page
+      // is modified.
+      if (!pTakeUndoImages(pos) ||
+          (kBitwiseCopyableTable && !pFindRedoLog()->FlushUndo())) {
+        assert(false);
+        std::abort();
+      }
+    }
+    if (const auto dirty_pages = side->dirty_pages) {
+      const auto* const region = ToAddress(table_);
+      DirtyPageMapType::Mark(dirty_pages, region, &pGetHeader(pos),
+                             sizeof(Header));
+      DirtyPageMapType::Mark(dirty_pages, region, &pGetData(pos),
+                             sizeof(DataHolderType));
+      if constexpr (kKeyArray) {
+        DirtyPageMapType::Mark(dirty_pages, region,
+                               region + pKeyOffset(Capacity(), pos),
+                               sizeof(KeyType));
+      }
+    }
+    if (auto* const snapshot = side->snapshot.Get()) {
+      if (!snapshot->Shared()) {
+        // The reader has released the snapshot already.
+        pDropSnapshot();
+        return;
+      }
+      snapshot->BeforeWrite(&pGetHeader(pos), sizeof(Header));
+      snapshot->BeforeWrite(&pGetData(pos), sizeof(DataHolderType));
+      if constexpr (kKeyArray) {
+        snapshot->BeforeWrite(ToAddress(table_) + pKeyOffset(Capacity(), pos),
+                              sizeof(KeyType));
+      }
+    }
+  }
+
+  inline void pLogInsert([[maybe_unused]] const SizeType pos) {
+    if constexpr (kChangeLogSupported) {
+      if (auto* const log = GetChangeLog()) {
+        log->RecordInsert(pGetEntry(pos).Get());
+      }
+    }
+  }
+
+  /// Return the snapshot this container writes through, if any.
+  inline SnapshotType* pSnapshot() const noexcept {
+    const auto* const side = pFindSide();
+    return side ? side->snapshot.Get() : nullptr;
+  }
+
+  /// Release this container's reference to the snapshot.
+  void pDropSnapshot() noexcept {
+    auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    auto* const snapshot = side->snapshot.Get();
+    if (snapshot && snapshot->Release()) {
+      delete snapshot;
+    }
+    side->snapshot.Reset();
+  }
+
+  /// Deallocate a table that is no longer used.
+  /// If a snapshot refers to the table, hand the table over to the snapshot
+  /// instead so that the reader keeps its view.
+  void pReleaseTable(BytePointer table, const SizeType capacity) {
+    auto* const snapshot = pSnapshot();
+    if (snapshot && table && snapshot->Region() == ToAddress(table)) {
+      snapshot->TakeOwnership(table);
+      pDropSnapshot();
+      return;
+    }
+    pDeallocateTable(table, capacity);
+  }
+
+  /// Replace the dirty page map with a new one that covers the current table.
+  /// Does nothing but freeing the map if the tracking is disabled.
+  bool pResetDirtyPages(const bool dirty) {
+    pFreeDirtyPages();
+    if (!TrackingDirtyPages() || Capacity() == 0) {
       return true;
     }
+    auto& side = pGetSide();
+    ByteAllocator alloc(GetAllocator());
+    side.dirty_pages = DirtyPageMapType::Allocate(
+        alloc, ToAddress(table_), pGetMemorySize(Capacity()), dirty);
+    return !!side.dirty_pages;
+  }
 
-    prhdtls::os_madvise(ToAddress(old_table), pGetMemorySize(old_capacity),
-                        MADV_SEQUENTIAL);
+  void pFreeDirtyPages() noexcept {
+    auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    ByteAllocator alloc(GetAllocator());
+    DirtyPageMapType::Deallocate(alloc, side->dirty_pages);
+    side->dirty_pages = nullptr;
+  }
 
-    for (SizeType i = 0; i < old_capacity; ++i) {
-      if (pGetHeader(old_table, i).Empty()) {
-        continue;
+  /// Return the dirty page map, or nullptr if the pages are not tracked.
+  inline BytePointer pDirtyPages() const noexcept {
+    const auto* const side = pFindSide();
+    return side ? side->dirty_pages : nullptr;
+  }
+
+  /// Take the dirty ranges and clear the dirty page map.
+  /// If entries are not embedded, the nodes referred to by the entries in the
+  /// dirty ranges are also included, and so are the pages of the container
+  /// (see pAddHandleRanges()).
+  std::vector<MemoryRange> pTakeDirtyRanges() {
+    const auto dirty_pages = pDirtyPages();
+    if (!dirty_pages) {
+      return {};
+    }
+    auto ranges =
+        DirtyPageMapType::TakeDirtyRanges(dirty_pages, ToAddress(table_));
+    pAddNodeRanges(ranges);
+    pAddHandleRanges(ranges);
+    CoalesceMemoryRanges(ranges);
+    return ranges;
+  }
+
+  /// Add the pages of the nodes referred to by the entries in the given table
+  /// ranges. Does nothing if entries are embedded.
+  void pAddNodeRanges(std::vector<MemoryRange>& ranges) const {
+    if constexpr (!embed) {
+      std::vector<MemoryRange> node_ranges;
+      for (const auto& range : ranges) {
+        for (auto pos = pFirstDataPositionIn(range);
+             pos < Capacity() && reinterpret_cast<std::byte*>(&pGetData(pos)) <
+                                     range.addr + range.length;
+             ++pos) {
+          if (pGetHeader(pos).Empty()) {
+            continue;
+          }
+          node_ranges.push_back(PageAlignedRange(&pGetData(pos).Get(),
+                                                 sizeof(KeyValueType)));
+        }
       }
-      pInsert(check_capacity, std::move(pGetData(old_table, old_capacity, i)));
-      pGetHeader(old_table, i).Clear();
-      pGetData(old_table, old_capacity, i).Clear(allocator_);
+      ranges.insert(ranges.end(), node_ranges.begin(), node_ranges.end());
+      CoalesceMemoryRanges(ranges);
     }
+  }
 
-    pDeallocateTable(old_table, old_capacity);
-    return true;
+  /// Return the first position whose data holder overlaps the given range.
+  /// Data holders are placed in ascending order of their position in both
+  /// layouts.
+  SizeType pFirstDataPositionIn(const MemoryRange& range) const {
+    SizeType low = 0;
+    SizeType high = Capacity();
+    while (low < high) {
+      const auto mid = low + (high - low) / 2;
+      const auto* const end =
+          reinterpret_cast<const std::byte*>(&pGetData(mid)) +
+          sizeof(DataHolderType);
+      if (end <= range.addr) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
   }
 
   template <typename... Args>
@@ -811,6 +2492,103 @@ class PerrohtImpl {
     return DataHolderType(allocator_, std::forward<Args>(args)...);
   }
 
+  /// Construct and insert a new element only if there is no element with the
+  /// key. The element is constructed once, through the allocator, directly in
+  /// the position it takes (see pInsertInPlace()); thus, with
+  /// std::scoped_allocator_adaptor, the key and the value receive the
+  /// container's allocator (uses-allocator construction).
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> pTryEmplace(K&& key, Args&&... args) {
+    SizeType pos = kNullPos;
+    {
+      bool found = false;
+      std::tie(pos, found) = pLocate(key);
+      if (found) {
+        return {Iterator(pos, this), false};
+      }
+    }
+
+    const bool aliased = pAnyInTable(key, args...);
+    if constexpr (std::is_same_v<Value, VoidValue>) {
+      static_assert(sizeof...(Args) == 0);
+      pos = pInsertInPlace(key, pos, aliased, std::forward<K>(key));
+    } else {
+      pos = pInsertInPlace(
+          key, pos, aliased, std::piecewise_construct,
+          std::forward_as_tuple(std::forward<K>(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    pLogInsert(pos);
+    return {Iterator(pos, this), true};
+  }
+
+  /// Insert a new element whose key is key, not checking the duplicate
+  /// entries. hint_pos is the position where pLocate() stopped.
+  /// A position is opened up for the element first (see pOpenPosition()),
+  /// and the element is constructed there from args. If aliased is true,
+  /// i.e., args refer to objects in the table, which can be moved while
+  /// opening up the position, the element is constructed beforehand instead.
+  template <typename... Args>
+  SizeType pInsertInPlace(const KeyType& key, SizeType hint_pos,
+                          const bool aliased, Args&&... args) {
+    if (aliased) {
+      return pInsert(true, pConstructDataHolder(std::forward<Args>(args)...),
+                     hint_pos);
+    }
+    if (!pEnoughCapacity(Size() + 1)) {
+      pGrow(Size() + 1);
+      // As the table is grown, the hint position is no longer valid.
+      hint_pos = kNullPos;
+    }
+    const auto hash = hasher_(key);
+    const auto pos = pOpenPosition(hash, hint_pos);
+    auto& holder = pGetEntry(pos);
+    OpenPositionGuard guard{*this, pos, hash};
+    DataHolderType::ConstructInPlace(allocator_, &holder,
+                                     std::forward<Args>(args)...);
+    guard.committed = true;
+    pSetFingerprint(holder, hash);
+    if (pos < Capacity()) {
+      pStoreKey(pos);
+    }
+    return pAutoGrow(pos);
+  }
+
+  /// Closes a position opened by pOpenPosition() on destruction unless
+  /// committed is set, i.e., if constructing the new element throws.
+  struct OpenPositionGuard {
+    ~OpenPositionGuard() {
+      if (!committed) {
+        self.pClosePosition(pos, hash);
+      }
+    }
+
+    PerrohtImpl& self;
+    SizeType pos;
+    std::size_t hash;
+    bool committed{false};
+  };
+
+  /// Return true if any of the objects is stored in the table.
+  /// Only embedded elements live in the table.
+  template <typename... Args>
+  bool pAnyInTable([[maybe_unused]] const Args&... objects) const {
+    if constexpr (!embed || sizeof...(Args) == 0) {
+      return false;
+    } else {
+      if (!table_) {
+        return false;
+      }
+      const auto begin = reinterpret_cast<std::uintptr_t>(ToAddress(table_));
+      const auto end = begin + pGetMemorySize(Capacity());
+      const auto in_table = [begin, end](const void* const ptr) {
+        const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+        return begin <= addr && addr < end;
+      };
+      return (in_table(std::addressof(objects)) || ...);
+    }
+  }
+
   inline SizeType pInsert(const bool check_capacity, DataHolderType&& data,
                           const SizeType hint_pos = kNullPos) {
     SizeType inserted_pos = kNullPos;  // The position where the new element is
@@ -822,70 +2600,249 @@ class PerrohtImpl {
     } else {
       inserted_pos = pForceInsert(std::move(data), hint_pos);
     }
-    if (GetApproximateMeanProbeDistance() > kAutoGrowProbeDistance &&
+    return pAutoGrow(inserted_pos);
+  }
+
+  /// Grow the table if the probe distances have become too long, unless
+  /// the stash can take the elements that would be placed too far.
+  /// Return the position of the element that was at pos.
+  SizeType pAutoGrow(const SizeType pos) {
+    // The table is not resized while a batch is applied; see ApplyBatch().
+    if (pProbeDistanceBound() == kNullPos && !pApplyingBatch() &&
+        GetApproximateMeanProbeDistance() > kAutoGrowProbeDistance &&
         LoadFactor() > kMinimumMaxLoadFactor) {
-      // As 'data' was moved already, we need to copy its key here so that
-      // we can find the new inserted position.
-      const auto key = KVTraits::GetKey(pGetData(inserted_pos).Get());
+      // Copy the key so that we can find the element after growing.
+      const auto key = KVTraits::GetKey(pGetEntry(pos).Get());
       Reserve(Capacity() * 2);
 
-      // Find the new inserted position
+      // Find the new position
       const auto [new_position, found] = pLocate(key);
       assert(found);
       return new_position;
     }
-    return inserted_pos;
+    return pos;
   }
 
   /// Insert an element to the table, not checking the capacity or the
   /// duplicate entries.
   SizeType pForceInsert(DataHolderType&& data,
                         const SizeType hint_pos = kNullPos) {
+    const auto hash = hasher_(KVTraits::GetKey(data.Get()));
+    pSetFingerprint(data, hash);
+    const auto pos = pOpenPosition(hash, hint_pos);
+    pMoveDataInto(pGetEntry(pos), data);
+    if (pos < Capacity()) {
+      pStoreKey(pos);
+    }
+    return pos;
+  }
+
+  /// Return the bound on the probe distances of the elements placed in the
+  /// table from now on, or kNullPos if nothing can be stashed now.
+  inline SizeType pProbeDistanceBound() const {
+    const auto* const side = pFindSide();
+    if (!side || side->stash_size == kStashCapacity || side->dirty_pages ||
+        side->snapshot.Get() || pApplyingBatch()) {
+      return kNullPos;
+    }
+    return side->stash_probe_bound;
+  }
+
+  /// Take a free data holder in the stash, allocating the stash if needed.
+  /// The data holder is left uninitialized; the new element is counted.
+  SizeType pTakeStashPosition() {
+    auto& side = pGetSide();
+    assert(side.stash_size < kStashCapacity);
+    if (!side.stash) {
+      ByteAllocator alloc(GetAllocator());
+      side.stash = AllocTraits<ByteAllocator>::allocate(
+          alloc, kStashCapacity * sizeof(DataHolderType));
+      if (!side.stash) {
+        assert(false);
+        std::abort();
+      }
+    }
+    return Capacity() + side.stash_size++;
+  }
+
+  /// Move the stashed elements back to the table, which has room for them as
+  /// they are counted in Size(). If restash is true, the elements that are
+  /// still placed too far are stashed again.
+  void pDrainStash(const bool restash) {
+    auto* const side = pFindSide();
+    if (!side) {
+      return;
+    }
+    const auto stash_probe_bound = side->stash_probe_bound;
+    if (!restash) {
+      side->stash_probe_bound = kNullPos;
+    }
+    for (auto n = side->stash_size; n > 0; --n) {
+      // Elements stashed again are appended; move the last one to the taken
+      // position, which is not visited again.
+      auto data = pMoveDataOut(pGetStashData(n - 1));
+      --side->stash_size;
+      if (n - 1 != side->stash_size) {
+        pRelocateData(pGetStashData(side->stash_size), pGetStashData(n - 1));
+      }
+      pForceInsert(std::move(data));
+    }
+    side->stash_probe_bound = stash_probe_bound;
+  }
+
+  /// Open up the position for a new element with the given hash value and
+  /// return it. The header of the position is set; its data holder is left
+  /// uninitialized. The new element is counted.
+  /// If the element would be placed farther than the max probe distance, a
+  /// position in the stash is returned instead (see pProbeDistanceBound()).
+  /// Instead of swapping the new element with each displaced one until the
+  /// run ends, this function finds the position at which the new element
+  /// lands first and then shifts the rest of the run by one position
+  /// (see pShiftRunForward()); the result satisfies the Robin Hood invariant
+  /// as well, with every displaced entry moved once.
+  SizeType pOpenPosition(const std::size_t hash, const SizeType hint_pos) {
     assert(Capacity() > 0);
     assert(pEnoughCapacity(Size() + 1));
 
-    SizeType inserted_pos = kNullPos;  // The position where the new element is
-                                       // inserted.
+    static_assert(std::is_same_v<CapacityAlgo, PowerOfTwoCapacity>);
     SizeType pos;
     SizeType dist;
     if (hint_pos != kNullPos) {
       pos = hint_pos;
-      dist = (pos - pIdealPosition(KVTraits::GetKey(data.Get())) + Capacity()) %
-             Capacity();
+      dist = (pos - (hash & (Capacity() - 1)) + Capacity()) % Capacity();
     } else {
-      pos = pIdealPosition(KVTraits::GetKey(data.Get()));
+      pos = hash & (Capacity() - 1);
       dist = 0;
     }
 
-    for (; dist < Capacity(); ++dist) {
-      auto& existing_data = pGetData(pos);
-      if (pGetHeader(pos).Empty()) {
-        pSetProbeDistance(pos, dist);
-        pUpdateMeanProbeDistanceWithNewDistance(dist, size_);
-        new (&existing_data) DataHolderType(std::move(data));  // Move construct
-        if (inserted_pos == kNullPos) {
-          inserted_pos = pos;
+    // Take the first empty position or the position of the first entry that
+    // is closer to its ideal position than the new element.
+    while (!pGetHeader(pos).Empty() && pGetProbeDistance(pos) >= dist) {
+      pos = pIncrementPosition(pos);
+      ++dist;
+      assert(dist < Capacity());
+    }
+    const auto bound = pProbeDistanceBound();
+    if (dist > bound) {
+      return pTakeStashPosition();
+    }
+    if (!pGetHeader(pos).Empty()) {
+      pShiftRunForward(pos, bound);
+    }
+    pBeforeWrite(pos);
+    pSetProbeDistance(pos, dist);
+    pUpdateMeanProbeDistanceWithNewDistance(dist, size_);
+    ++size_;
+    return pos;
+  }
+
+  /// Undo pOpenPosition() for a position whose data holder has not been
+  /// constructed: the run that follows the position is shifted back, as when
+  /// an element is erased, and the new element is no longer counted. hash is
+  /// the hash value of the new element. An entry moved to the stash to open
+  /// the position stays there.
+  void pClosePosition(const SizeType pos, const std::size_t hash) {
+    if (pos >= Capacity()) {
+      // The stash position taken last.
+      assert(pos == pEndPosition() - 1);
+      --pFindSide()->stash_size;
+      return;
+    }
+    const auto dist = (pos - hash) & (Capacity() - 1);
+    if constexpr (kRelocatableEntry) {
+      pBeforeWrite(pos);
+      pShiftRunBackBytes(pos);
+    } else {
+      auto hole = pos;  // The position whose data holder is not constructed.
+      for (auto i = pIncrementPosition(pos);
+           !pGetHeader(i).Empty() && pGetProbeDistance(i) > 0;
+           i = pIncrementPosition(i)) {
+        const auto old_pd = pGetProbeDistance(i);
+        pBeforeWrite(hole);
+        pMoveDataInto(pGetData(hole), pGetData(i));
+        pGetData(i).Clear(allocator_);
+        pStoreKey(hole);
+        pSetProbeDistance(hole, old_pd - 1);
+        pUpdateMeanProbeDistance(old_pd, old_pd - 1, size_);
+        hole = i;
+      }
+      pBeforeWrite(hole);
+      pGetHeader(hole).Clear();
+    }
+    pUpdateMeanProbeDistanceWithoutDistance(dist, size_);
+    --size_;
+  }
+
+  /// Shift the entries from first to the next empty position forward by one
+  /// position. Each entry is moved once; the data of relocatable entries is
+  /// moved with memmove, at once if the data holders are stored in an array
+  /// of their own. The data holder at first is left uninitialized.
+  /// The first entry whose probe distance would exceed bound is moved to the
+  /// stash instead, and the entries after it stay.
+  void pShiftRunForward(const SizeType first, const SizeType bound) {
+    auto last = first;  // The position to fill.
+    while (!pGetHeader(last).Empty() && pGetProbeDistance(last) < bound) {
+      last = pIncrementPosition(last);
+    }
+    if (!pGetHeader(last).Empty()) {
+      const auto pd = pGetProbeDistance(last);
+      auto data = pMoveDataOut(pGetData(last));
+      pMoveDataInto(pGetEntry(pTakeStashPosition()), data);
+      pUpdateMeanProbeDistanceWithoutDistance(pd, size_);
+      --size_;
+      if (last == first) {
+        return;
+      }
+    }
+
+    // Update the headers from the back, before the data is moved, as getting
+    // a probe distance may need the key.
+    for (auto i = last; i != first;) {
+      const auto pre_i = pDecrementPosition(i);
+      const auto old_pd = pGetProbeDistance(pre_i);
+      pBeforeWrite(i);
+      pSetProbeDistance(i, old_pd + 1);
+      pUpdateMeanProbeDistance(old_pd, old_pd + 1, size_);
+      i = pre_i;
+    }
+
+    if constexpr (kRelocatableEntry) {
+      const auto capacity = Capacity();
+      auto* const table = ToAddress(table_);
+      auto num_shifted = (last - first) & (capacity - 1);
+      auto dst = last;  // The last position of the next chunk to fill.
+      while (num_shifted > 0) {
+        SizeType n = 1;
+        if constexpr (kSeparateHeader) {
+          // The data holders of dst - n to dst are contiguous.
+          n = std::min(num_shifted, dst);
+        }
+        if (n == 0) {
+          n = 1;  // dst is the first position; src wraps around.
         }
-        ++size_;
-        return inserted_pos;
-      }
-
-      const auto existing_pd = pGetProbeDistance(pos);
-      if (existing_pd < dist) {
-        using std::swap;
-        swap(existing_data, data);
-        pSetProbeDistance(pos, dist);
-        pUpdateMeanProbeDistance(existing_pd, dist, size_);
-        dist = existing_pd;
-        if (inserted_pos == kNullPos) {
-          inserted_pos = pos;
+        const auto src = pDecrementPosition(dst - n + 1);
+        std::memmove(
+            static_cast<void*>(&pRawData(table, capacity, dst - n + 1)),
+            &pRawData(table, capacity, src), n * sizeof(DataHolderType));
+        for (SizeType k = 0; k < n; ++k) {
+          pStoreKey(dst);
+          dst = pDecrementPosition(dst);
         }
+        num_shifted -= n;
       }
-      pos = pIncrementPosition(pos);
+    } else {
+      auto dst = last;
+      auto src = pDecrementPosition(dst);
+      pMoveDataInto(pGetData(dst), pGetData(src));
+      pStoreKey(dst);
+      while (src != first) {
+        dst = src;
+        src = pDecrementPosition(dst);
+        pGetData(dst).MoveAssign(allocator_, std::move(pGetData(src)));
+        pStoreKey(dst);
+      }
+      pGetData(first).Clear(allocator_);
     }
-
-    assert(false && "Should not reach here");
-    return kNullPos;
   }
 
   /// Clear the entry at the given position.
@@ -895,6 +2852,7 @@ class PerrohtImpl {
     if (pGetHeader(pos).Empty()) {
       return;
     }
+    pBeforeWrite(pos);
     pGetHeader(pos).Clear();
     pGetData(pos).Clear(allocator_);
   }
@@ -912,11 +2870,29 @@ class PerrohtImpl {
   // Then, shift the following elements forward until an empty slot or an
   // element with probe distance 0 is found.
   inline void pEraseSingleAt(const SizeType pos) {
+    if constexpr (kChangeLogSupported) {
+      if (auto* const log = GetChangeLog()) {
+        log->RecordErase(KVTraits::GetKey(pGetEntry(pos).Get()));
+      }
+    }
+    if (pos >= Capacity()) {
+      pEraseFromStash(pos - Capacity());
+      return;
+    }
+    if constexpr (kRelocatableEntry) {
+      pEraseAndShiftBytes(pos);
+      --size_;
+      return;
+    }
     auto i = pIncrementPosition(pos);
     while (!pGetHeader(i).Empty() && pGetProbeDistance(i) > 0) {
       const auto pre_i = pDecrementPosition(i);
-      pGetData(pre_i).MoveAssign(allocator_, std::move(pGetData(i)));
+      // Get the probe distance before moving the data out, as it may need
+      // the key to compute the distance.
       const auto old_pd = pGetProbeDistance(i);
+      pBeforeWrite(pre_i);
+      pGetData(pre_i).MoveAssign(allocator_, std::move(pGetData(i)));
+      pStoreKey(pre_i);
       pSetProbeDistance(pre_i, old_pd - 1);
       pUpdateMeanProbeDistance(old_pd, old_pd - 1, size_);
       i = pIncrementPosition(i);
@@ -925,25 +2901,205 @@ class PerrohtImpl {
     --size_;
   }
 
+  /// Return true if erasing the entry at pos shifts the entry at position 0
+  /// back to the last position.
+  bool pEraseShiftWrapsAround(const SizeType pos) const {
+    for (auto i = pos + 1; i < Capacity(); ++i) {
+      if (pGetHeader(i).Empty() || pGetProbeDistance(i) == 0) {
+        return false;
+      }
+    }
+    return pos > 0 && !pGetHeader(0).Empty() && pGetProbeDistance(0) > 0;
+  }
+
+  /// Erase the i-th stashed element and move the last one to its place.
+  void pEraseFromStash(const SizeType i) {
+    auto& side = *pFindSide();
+    pGetStashData(i).Clear(allocator_);
+    --side.stash_size;
+    if (i != side.stash_size) {
+      pRelocateData(pGetStashData(side.stash_size), pGetStashData(i));
+    }
+  }
+
+  /// pEraseSingleAt() for relocatable entries. The erased entry is destroyed
+  /// first; then, the headers of the following run are updated, and the data
+  /// of the run is moved back by one position with memmove, at once if the
+  /// data holders are stored in an array of their own.
+  void pEraseAndShiftBytes(const SizeType pos) {
+    pBeforeWrite(pos);
+    pGetData(pos).Clear(allocator_);
+    pShiftRunBackBytes(pos);
+  }
+
+  /// Move the run that follows pos back by one position; the data holder at
+  /// pos must be uninitialized. Requires relocatable entries.
+  void pShiftRunBackBytes(const SizeType pos) {
+    SizeType last = pos;  // The position that becomes empty.
+    SizeType num_shifted = 0;
+    for (auto i = pIncrementPosition(pos);
+         !pGetHeader(i).Empty() && pGetProbeDistance(i) > 0;
+         i = pIncrementPosition(i)) {
+      const auto old_pd = pGetProbeDistance(i);
+      pBeforeWrite(i);
+      pSetProbeDistance(last, old_pd - 1);
+      pUpdateMeanProbeDistance(old_pd, old_pd - 1, size_);
+      last = i;
+      ++num_shifted;
+    }
+    pGetHeader(last).Clear();
+
+    const auto capacity = Capacity();
+    auto* const table = ToAddress(table_);
+    auto dst = pos;
+    while (num_shifted > 0) {
+      SizeType n = 1;
+      if constexpr (kSeparateHeader) {
+        // The data holders of dst to dst + n are contiguous.
+        n = std::min(num_shifted, capacity - 1 - dst);
+      }
+      if (n == 0) {
+        n = 1;  // dst is the last position; src wraps around.
+      }
+      const auto src = pIncrementPosition(dst);
+      std::memmove(static_cast<void*>(&pRawData(table, capacity, dst)),
+                   &pRawData(table, capacity, src), n * sizeof(DataHolderType));
+      for (SizeType k = 0; k < n; ++k) {
+        pStoreKey(dst);
+        dst = pIncrementPosition(dst);
+      }
+      num_shifted -= n;
+    }
+  }
+
   bool pEqual(const PerrohtImpl& other) const noexcept {
     if (Size() != other.Size()) {
       return false;
     }
 
+    // Tables of the same capacity usually hold the same entries at the same
+    // positions; compare them side by side and look up the others only.
+    const bool same_capacity = Capacity() == other.Capacity();
     for (SizeType i = 0; i < Capacity(); ++i) {
       if (pGetHeader(i).Empty()) {
         continue;
       }
+      if (same_capacity && !other.pGetHeader(i).Empty() &&
+          pGetData(i).Get() == other.pGetData(i).Get()) {
+        continue;
+      }
 
       const auto& key = KVTraits::GetKey(pGetData(i).Get());
       const auto [pos, found] = other.pLocate(key);
-      if (!found || pGetData(i).Get() != other.pGetData(pos).Get()) {
+      if (!found || pGetData(i).Get() != other.pGetEntry(pos).Get()) {
+        return false;
+      }
+    }
+    for (SizeType i = 0; i < pStashSize(); ++i) {
+      const auto& data = pGetStashData(i).Get();
+      const auto [pos, found] = other.pLocate(KVTraits::GetKey(data));
+      if (!found || data != other.pGetEntry(pos).Get()) {
         return false;
       }
     }
     return true;
   }
 
+  /// The state of the features that most containers do not use: resizes in
+  /// progress, dirty page tracking, batches, snapshots, change logs, and the
+  /// overflow stash. It is allocated on first use and deallocated when it
+  /// holds the defaults again at the end of a resize, so that the container
+  /// itself stays small.
+  struct SideState {
+    ResizeDescriptorType resize{};
+    BytePointer dirty_pages{nullptr};
+    bool track_dirty_pages{false};
+    bool resize_in_place{false};
+    RedoLogPointer redo_log{nullptr};
+    // Snapshots and change logs are heap objects of the process that set
+    // them; they read as null in other processes.
+    ProcessLocalPointer<SnapshotType> snapshot{};
+    ProcessLocalPointer<ChangeLogType> change_log{};
+    SizeType stash_probe_bound{kNullPos};
+    BytePointer stash{nullptr};  // kStashCapacity data holders
+    SizeType stash_size{0};      // Not counted in size_
+  };
+  using SideAllocator = RebindAlloc<Allocator, SideState>;
+  using SidePointer = typename AllocTraits<SideAllocator>::pointer;
+
+  /// Return the side state, or nullptr if it has not been allocated.
+  inline SideState* pFindSide() const noexcept {
+    return side_ ? ToAddress(side_) : nullptr;
+  }
+
+  /// Return the side state, allocating it if it does not exist yet.
+  SideState& pGetSide() {
+    if (!side_) {
+      SideAllocator alloc(allocator_);
+      SidePointer side = AllocTraits<SideAllocator>::allocate(alloc, 1);
+      if (!side) {
+        assert(false);
+        std::abort();
+      }
+      new (ToAddress(side)) SideState();
+      // The side state must be initialized before it becomes reachable.
+      std::atomic_thread_fence(std::memory_order_release);
+      side_ = side;
+    }
+    return *ToAddress(side_);
+  }
+
+  /// Deallocate the side state if it holds the defaults only.
+  void pReleaseIdleSide() noexcept {
+    const auto* const side = pFindSide();
+    if (!side || !side->resize.Idle() || side->dirty_pages ||
+        side->track_dirty_pages || side->resize_in_place || side->redo_log ||
+        side->snapshot.Get() || side->change_log.Get() ||
+        side->stash_probe_bound != kNullPos || side->stash) {
+      return;
+    }
+    pFreeSide();
+  }
+
+  /// Deallocate the side state. The redo log and the stash must have been
+  /// freed.
+  void pFreeSide() noexcept {
+    if (!side_) {
+      return;
+    }
+    SidePointer side = side_;
+    side_ = nullptr;
+    std::atomic_thread_fence(std::memory_order_release);
+    ToAddress(side)->~SideState();
+    SideAllocator alloc(allocator_);
+    AllocTraits<SideAllocator>::deallocate(alloc, side, 1);
+  }
+
+  inline bool pResizeIdle() const noexcept {
+    const auto* const side = pFindSide();
+    return !side || side->resize.Idle();
+  }
+
+  /// Take over the table and the side state of other, which uses the same
+  /// allocator as this container.
+  void pMoveMembersFrom(SelfType& other) noexcept {
+    mean_probe_distance_ = std::move(other.mean_probe_distance_);
+    size_ = std::move(other.size_);
+    capacity_index_ = std::move(other.capacity_index_);
+    table_ = std::move(other.table_);
+    side_ = std::move(other.side_);
+
+    other.mean_probe_distance_ = 0;
+    other.size_ = 0;
+    other.capacity_index_ = 0;
+    other.table_ = nullptr;
+    other.side_ = nullptr;
+  }
+
+  template <typename K, typename V, typename H, typename E, bool e,
+            typename A, typename L>
+  friend class PerrohtImpl;
+
   float max_load_factor_{0.875};  // TODO: remove or uses more compact type
   Allocator allocator_{};         // 8B
   Hasher hasher_{};
@@ -952,38 +3108,43 @@ class PerrohtImpl {
   SizeType size_{0};                           // 8B
   CapacityAlgo::IndexType capacity_index_{0};  // 1B
   BytePointer table_{nullptr};                 // 8B
+  SidePointer side_{nullptr};                  // 8B
 };
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr bool operator==(
-    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd,
-    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>&
+    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        lhd,
+    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
         rhd) noexcept {
   return lhd.pEqual(rhd);
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr bool operator!=(
-    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd,
-    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>&
+    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        lhd,
+    const PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
         rhd) noexcept {
   return !(lhd == rhd);
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr void swap(
-    PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd,
-    PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>& rhd) noexcept {
+    PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>& lhd,
+    PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        rhd) noexcept {
   lhd.Swap(rhd);
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 template <bool IsConst>
-class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>::BaseIterator {
+class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc,
+                  Layout>::BaseIterator {
  private:
   using ContainerPointer = typename std::conditional_t<
       IsConst,
@@ -999,24 +3160,24 @@ class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>::BaseIterator {
   using pointer =
       typename std::conditional<IsConst, const value_type*, value_type*>::type;
 
-  BaseIterator(const SizeType pos, ContainerPointer container)
-      : start_pos_(pos), container_(container) {
+  /// A default constructed iterator is singular; it can only be assigned.
+  BaseIterator() = default;
+
+  /// Conversion from an iterator to a const iterator.
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  BaseIterator(const BaseIterator<false>& other)
+      : pos_(other.pos_), skip_(other.skip_), container_(other.container_) {}
+
+  /// Construct an iterator to the first entry at or after the given position.
+  /// The positions before it are not visited.
+  /// \param skip A table position to pass over, e.g., one whose entry has
+  /// been visited already.
+  BaseIterator(const SizeType pos, ContainerPointer container,
+               const SizeType skip = kNullPos)
+      : pos_(pos), skip_(skip), container_(container) {
     assert(container_);
-    assert(start_pos_ <= container_->Capacity());
-
-    // Already at the end?
-    if (start_pos_ == container_->Capacity()) {
-      // Move the offset_t to the 'end' position.
-      offset_ = container_->Capacity();
-      return;
-    }
-
-    // Make sure to move to the first valid position.
-    for (; offset_ < container_->Capacity(); ++offset_) {
-      if (!pHeader().Empty()) {
-        break;
-      }
-    }
+    assert(pos_ <= container_->pEndPosition());
+    pMoveToValid();
   }
 
   BaseIterator& operator++() {
@@ -1035,8 +3196,8 @@ class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>::BaseIterator {
   pointer operator->() const { return &(pGet()); }
 
   bool operator==(const BaseIterator& other) const {
-    if (offset_ == container_->Capacity() &&
-        other.offset_ == other.container_->Capacity()) {
+    if (pos_ >= container_->pEndPosition() &&
+        other.pos_ >= other.container_->pEndPosition()) {
       // Both are at the end
       return true;
     }
@@ -1046,31 +3207,287 @@ class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>::BaseIterator {
 
   bool operator!=(const BaseIterator& other) const { return !(*this == other); }
 
-  SizeType Position() const { return start_pos_ + offset_; }
+  SizeType Position() const { return pos_; }
 
  private:
   auto& pHeader() const { return container_->pGetHeader(Position()); }
 
-  auto& pGet() const { return container_->pGetData(Position()).Get(); }
+  auto& pGet() const { return container_->pGetEntry(Position()).Get(); }
 
   // Move to the next valid position.
   void pMoveToNext() {
-    if (offset_ == container_->Capacity()) {
+    if (pos_ >= container_->pEndPosition()) {
       return;
     }
-    ++offset_;
-    for (; offset_ < container_->Capacity(); ++offset_) {
-      if (!pHeader().Empty()) {
+    ++pos_;
+    pMoveToValid();
+  }
+
+  // Move to the first valid position at or after the current one.
+  // All positions in the stash are valid.
+  void pMoveToValid() {
+    for (; pos_ < container_->Capacity(); ++pos_) {
+      if (!pHeader().Empty() && pos_ != skip_) {
         break;
       }
     }
   }
 
-  SizeType start_pos_{0};
-  // possible range [0, capacity]
-  // offset_ == capacity means that the iterator is at the 'end' position.
-  SizeType offset_{0};
+  template <bool>
+  friend class BaseIterator;
+
+  // possible range [0, capacity + stash size]
+  // Positions from capacity on refer to the stash; the last one means that
+  // the iterator is at the 'end' position.
+  SizeType pos_{0};
+  SizeType skip_{kNullPos};
+  ContainerPointer container_{nullptr};
+};
+
+/// \brief A view of a container that resolves the address and the capacity
+/// of the table once, so that a batch of lookups, insertions, and erasures
+/// works on raw pointers instead of the allocator's pointer type, e.g., an
+/// offset pointer.
+/// The view follows the changes made through it, including the table being
+/// grown by an insertion. Call Refresh() after the container is modified
+/// through anything else; the caller is responsible for not using a stale
+/// view.
+template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
+          bool embed, typename Alloc, typename Layout>
+template <bool IsConst>
+class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc,
+                  Layout>::BaseView {
+ private:
+  using ContainerPointer =
+      std::conditional_t<IsConst, const SelfType*, SelfType*>;
+  using TablePointer =
+      std::conditional_t<IsConst, const std::byte*, std::byte*>;
+
+ public:
+  using pointer =
+      std::conditional_t<IsConst, const KeyValueType*, KeyValueType*>;
+
+  explicit BaseView(ContainerPointer container) : container_(container) {
+    assert(container_);
+    Refresh();
+  }
+
+  /// \brief Resolve the table address and the capacity again.
+  void Refresh() {
+    table_ = ToAddress(container_->table_);
+    capacity_ = container_->Capacity();
+  }
+
+  SizeType Size() const { return container_->Size(); }
+
+  SizeType Capacity() const { return capacity_; }
+
+  /// \brief Find the element with the given key.
+  /// \return A pointer to the element, or nullptr if there is none.
+  pointer Find(const KeyType& key) const {
+    const auto [pos, found] = container_->pLocateIn(table_, capacity_, key);
+    return found ? &pGet(pos) : nullptr;
+  }
+
+  bool Contains(const KeyType& key) const {
+    return container_->pLocateIn(table_, capacity_, key).second;
+  }
+
+  SizeType Count(const KeyType& key) const { return Contains(key) ? 1 : 0; }
+
+  /// \brief Insert an element if there is no element with the same key.
+  /// \return A pair of a pointer to the element with the key and a bool
+  /// that is true if the element was inserted.
+  template <typename KVType>
+  std::pair<pointer, bool> Insert(KVType&& data) {
+    static_assert(!IsConst, "Cannot insert through a ConstView");
+    const auto [pos, found] =
+        container_->pLocateIn(table_, capacity_, KVTraits::GetKey(data));
+    if (found) {
+      return {&pGet(pos), false};
+    }
+    auto d = container_->pConstructDataHolder(std::forward<KVType>(data));
+    const auto inserted_pos = container_->pInsert(true, std::move(d), pos);
+    container_->pLogInsert(inserted_pos);
+    Refresh();  // The table may have been grown.
+    return {&pGet(inserted_pos), true};
+  }
+
+  /// \brief Erase the element with the given key.
+  /// \return The number of elements erased.
+  SizeType Erase(const KeyType& key) {
+    static_assert(!IsConst, "Cannot erase through a ConstView");
+    const auto [pos, found] = container_->pLocateIn(table_, capacity_, key);
+    if (!found) {
+      return 0;
+    }
+    container_->pEraseSingleAt(pos);
+    return 1;
+  }
+
+ private:
+  auto& pGet(const SizeType pos) const {
+    if (pos >= capacity_) {
+      return container_->pGetEntry(pos).Get();
+    }
+    return pRawData(table_, capacity_, pos).Get();
+  }
+
   ContainerPointer container_{nullptr};
+  TablePointer table_{nullptr};
+  SizeType capacity_{0};
+};
+
+/// \brief A read-only view of a table at the time a snapshot was taken.
+/// Accesses to the view are thread-safe with respect to the modifications of
+/// the container, but the view itself must not be shared by multiple threads
+/// without synchronization.
+/// Elements are returned by value as the view reads them from either the
+/// table or the pages copied by the container.
+template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
+          bool embed, typename Alloc, typename Layout>
+class PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc,
+                  Layout>::SnapshotView {
+ public:
+  /// \brief Construct an invalid view.
+  SnapshotView() = default;
+
+  SnapshotView(const SnapshotView&) = delete;
+  SnapshotView& operator=(const SnapshotView&) = delete;
+
+  SnapshotView(SnapshotView&& other) noexcept { *this = std::move(other); }
+
+  SnapshotView& operator=(SnapshotView&& other) noexcept {
+    if (this == &other) return *this;
+    Release();
+    snapshot_ = other.snapshot_;
+    table_ = other.table_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    hasher_ = std::move(other.hasher_);
+    key_equal_ = std::move(other.key_equal_);
+    valid_ = other.valid_;
+    other.snapshot_ = nullptr;
+    other.valid_ = false;
+    return *this;
+  }
+
+  ~SnapshotView() noexcept { Release(); }
+
+  /// \brief Return false if the snapshot could not be taken or was released.
+  inline bool Valid() const noexcept { return valid_; }
+
+  inline SizeType Size() const noexcept { return size_; }
+
+  inline SizeType Capacity() const noexcept { return capacity_; }
+
+  /// \brief Find the element with the given key.
+  std::optional<KeyValueType> Find(const KeyType& key) const {
+    if (capacity_ == 0) {
+      return std::nullopt;
+    }
+    auto pos = pIdealPosition(key);
+    for (SizeType dist = 0; dist < capacity_; ++dist) {
+      const auto header = pReadHeader(pos);
+      if (header.Empty()) {
+        break;
+      }
+      const auto kv = pReadData(pos);
+      if (pProbeDistance(header, kv, pos) < dist) {
+        break;
+      }
+      if (key_equal_(KVTraits::GetKey(kv), key)) {
+        return kv;
+      }
+      pos = (pos + 1) % capacity_;
+    }
+    return std::nullopt;
+  }
+
+  inline bool Contains(const KeyType& key) const {
+    return Find(key).has_value();
+  }
+
+  /// \brief Call func(const KeyValueType&) for each element.
+  template <typename Func>
+  void ForEach(Func&& func) const {
+    for (SizeType pos = 0; pos < capacity_; ++pos) {
+      if (!pReadHeader(pos).Empty()) {
+        func(static_cast<const KeyValueType&>(pReadData(pos)));
+      }
+    }
+  }
+
+  /// \brief Return the number of pages copied by the container so far.
+  SizeType NumCopiedPages() const {
+    return snapshot_ ? snapshot_->NumCopiedPages() : 0;
+  }
+
+  /// \brief Release the snapshot.
+  /// The copied pages are freed by the container on its next modification,
+  /// or by this function if the container no longer refers to them.
+  void Release() noexcept {
+    if (snapshot_ && snapshot_->Release()) {
+      delete snapshot_;
+    }
+    snapshot_ = nullptr;
+    table_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    valid_ = false;
+  }
+
+ private:
+  friend class PerrohtImpl;
+
+  SnapshotView(SnapshotType* const snapshot, const std::byte* const table,
+               const SizeType capacity, const SizeType size,
+               const Hasher& hasher, const KeyEqual& key_equal)
+      : snapshot_(snapshot),
+        table_(table),
+        capacity_(capacity),
+        size_(size),
+        hasher_(hasher),
+        key_equal_(key_equal),
+        valid_(true) {
+    if (snapshot_) {
+      snapshot_->Retain();
+    }
+  }
+
+  inline SizeType pIdealPosition(const KeyType& key) const {
+    return hasher_(key) % capacity_;
+  }
+
+  Header pReadHeader(const SizeType pos) const {
+    Header header;
+    snapshot_->Read(table_ + pHeaderOffset(pos), &header, sizeof(Header));
+    return header;
+  }
+
+  KeyValueType pReadData(const SizeType pos) const {
+    alignas(KeyValueType) std::byte buf[sizeof(KeyValueType)];
+    snapshot_->Read(table_ + pDataOffset(capacity_, pos), buf,
+                    sizeof(KeyValueType));
+    return *std::launder(reinterpret_cast<KeyValueType*>(buf));
+  }
+
+  SizeType pProbeDistance(const Header& header, const KeyValueType& kv,
+                          const SizeType pos) const {
+    if (header.GetProbeDistance() < Header::MaxProbeDistance()) {
+      return header.GetProbeDistance();
+    }
+    const auto ipos = pIdealPosition(KVTraits::GetKey(kv));
+    return (pos + capacity_ - ipos) % capacity_;
+  }
+
+  SnapshotType* snapshot_{nullptr};
+  const std::byte* table_{nullptr};
+  SizeType capacity_{0};
+  SizeType size_{0};
+  Hasher hasher_{};
+  KeyEqual key_equal_{};
+  bool valid_{false};
 };
 
 }  // namespace perroht::prhdtls
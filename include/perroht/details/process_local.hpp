@@ -0,0 +1,53 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace perroht::prhdtls {
+
+/// \brief A raw pointer to a heap object that may be stored in persistent
+/// memory.
+/// The pointer is stored with a token drawn once per process, and Get()
+/// returns nullptr unless the token is the one of the calling process.
+/// Thus, a pointer set by a process that has exited reads as null after the
+/// persistent memory is reopened, instead of dangling.
+/// A child process created by fork(2) inherits the token along with the
+/// copy of the heap object.
+template <typename T>
+class ProcessLocalPointer {
+ public:
+  ProcessLocalPointer() = default;
+
+  inline T* Get() const noexcept {
+    return ptr_ && token_ == pToken() ? ptr_ : nullptr;
+  }
+
+  inline void Reset(T* const ptr = nullptr) noexcept {
+    ptr_ = ptr;
+    token_ = ptr ? pToken() : 0;
+  }
+
+ private:
+  /// Return the token of this process, which is never 0.
+  static uint64_t pToken() noexcept {
+    static const uint64_t token = [] {
+      std::random_device device;
+      const auto now = std::chrono::steady_clock::now().time_since_epoch();
+      std::mt19937_64 rng((uint64_t(device()) << 32) ^ device() ^
+                          uint64_t(now.count()));
+      return rng() | 1;
+    }();
+    return token;
+  }
+
+  T* ptr_{nullptr};
+  uint64_t token_{0};
+};
+
+}  // namespace perroht::prhdtls
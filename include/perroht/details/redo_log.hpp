@@ -0,0 +1,459 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "memory.hpp"
+#include "dirty_page_map.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief An operation in a batch applied by PerrohtImpl::ApplyBatch().
+template <typename KeyType, typename KeyValueType>
+struct BatchOperation {
+  enum class Type : uint8_t { kInsert = 0, kErase = 1 };
+
+  static BatchOperation Insert(KeyValueType key_value) {
+    return BatchOperation{Type::kInsert, std::move(key_value), std::nullopt};
+  }
+
+  static BatchOperation Erase(KeyType key) {
+    return BatchOperation{Type::kErase, std::nullopt, std::move(key)};
+  }
+
+  Type type{Type::kInsert};
+  std::optional<KeyValueType> key_value{};
+  std::optional<KeyType> key{};
+};
+
+/// \brief A growable array whose storage is allocated by the given allocator.
+/// Unlike std::vector, the allocator is not held by this class so that
+/// the owner can keep a single allocator for multiple arrays.
+template <typename T, typename Allocator>
+class PersistentArray {
+ private:
+  using ElementAllocator = RebindAlloc<Allocator, T>;
+  using Pointer = typename AllocTraits<ElementAllocator>::pointer;
+
+ public:
+  using SizeType = std::size_t;
+
+  template <typename... Args>
+  bool PushBack(const Allocator& allocator, Args&&... args) {
+    ElementAllocator alloc(allocator);
+    if (size_ == capacity_ &&
+        !pGrow(alloc, std::max(SizeType(8), capacity_ * 2), false)) {
+      return false;
+    }
+    AllocTraits<ElementAllocator>::construct(alloc, Data() + size_,
+                                             std::forward<Args>(args)...);
+    ++size_;
+    return true;
+  }
+
+  /// \brief Resize the array to n elements. New elements are zero-filled.
+  bool Resize(const Allocator& allocator, const SizeType n) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (!Reserve(allocator, n)) {
+      return false;
+    }
+    if (n > size_) {
+      std::memset(static_cast<void*>(Data() + size_), 0,
+                  (n - size_) * sizeof(T));
+    }
+    size_ = n;
+    return true;
+  }
+
+  /// \brief Make room for n elements in total.
+  /// If sync is true and the elements are moved to new storage, they are
+  /// flushed before the array switches to the new storage. Thus, the array
+  /// stays readable after a crash even if its header had been written back
+  /// before it was flushed again.
+  bool Reserve(const Allocator& allocator, const SizeType n,
+               const bool sync = false) {
+    if (n <= capacity_) {
+      return true;
+    }
+    ElementAllocator alloc(allocator);
+    return pGrow(alloc, std::max(n, capacity_ * 2), sync);
+  }
+
+  /// \brief Destroy all elements, keeping the storage.
+  void Clear(const Allocator& allocator) {
+    ElementAllocator alloc(allocator);
+    for (SizeType i = 0; i < size_; ++i) {
+      AllocTraits<ElementAllocator>::destroy(alloc, Data() + i);
+    }
+    size_ = 0;
+  }
+
+  /// \brief Destroy all elements and deallocate the storage.
+  void Free(const Allocator& allocator) {
+    Clear(allocator);
+    if (data_) {
+      ElementAllocator alloc(allocator);
+      AllocTraits<ElementAllocator>::deallocate(alloc, data_, capacity_);
+    }
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+
+  inline T* Data() const { return data_ ? ToAddress(data_) : nullptr; }
+
+  inline SizeType Size() const { return size_; }
+
+  inline T& operator[](const SizeType i) { return Data()[i]; }
+
+  inline const T& operator[](const SizeType i) const { return Data()[i]; }
+
+  /// \brief Return the memory range that holds the elements.
+  inline MemoryRange Range() const {
+    return MemoryRange{reinterpret_cast<std::byte*>(Data()), size_ * sizeof(T)};
+  }
+
+ private:
+  bool pGrow(ElementAllocator& alloc, const SizeType new_capacity,
+             const bool sync) {
+    Pointer new_data = AllocTraits<ElementAllocator>::allocate(alloc,
+                                                               new_capacity);
+    if (!new_data) {
+      return false;
+    }
+    for (SizeType i = 0; i < size_; ++i) {
+      AllocTraits<ElementAllocator>::construct(alloc, ToAddress(new_data) + i,
+                                               std::move(Data()[i]));
+      AllocTraits<ElementAllocator>::destroy(alloc, Data() + i);
+    }
+    bool synced = true;
+    if (sync && size_ > 0) {
+      const auto range =
+          PageAlignedRange(ToAddress(new_data), size_ * sizeof(T));
+      synced = os_msync(range.addr, range.length);
+    }
+    if (data_) {
+      AllocTraits<ElementAllocator>::deallocate(alloc, data_, capacity_);
+    }
+    data_ = new_data;
+    capacity_ = new_capacity;
+    return synced;
+  }
+
+  Pointer data_{nullptr};
+  SizeType size_{0};
+  SizeType capacity_{0};
+};
+
+/// \brief A redo log that makes a batch of operations atomic.
+/// The log is allocated by the container's allocator so that it survives in
+/// a persistent memory segment together with the container.
+/// A batch is written to the log and flushed before it is applied to the
+/// table. If the process dies before the log was committed, the table is left
+/// untouched. Otherwise, the batch is applied again on reopen.
+/// As the batch is applied to the table in place, the log also keeps undo
+/// images of the table pages modified by the batch: the image of a page is
+/// flushed before the page is modified for the first time in the batch.
+/// On reopen, the images are copied back so that the batch is applied again
+/// to the table as it was before the batch, together with the table size and
+/// mean probe distance recorded at the commit.
+/// Undo images can restore only tables whose elements are embedded and
+/// bitwise copyable. For other tables, only the modified pages are recorded,
+/// so that they can be flushed at the end of the batch, and a batch
+/// interrupted while it was applied cannot be recovered.
+template <typename KeyType, typename KeyValueType, typename Allocator>
+class RedoLog {
+ public:
+  using OperationType = BatchOperation<KeyType, KeyValueType>;
+  using OpType = typename OperationType::Type;
+  using SizeType = std::size_t;
+
+  enum class State : uint8_t {
+    /// There is no batch to replay.
+    kEmpty = 0,
+    /// A batch is being written. It is discarded on recovery.
+    kWriting = 1,
+    /// The batch is durable and is being applied. On recovery, the undo
+    /// images are restored and the batch is applied again.
+    kCommitted = 2,
+    /// The batch is being applied without undo images. The table cannot be
+    /// recovered.
+    kApplying = 3,
+  };
+
+  /// \brief Write the given operations to the log.
+  /// The previous batch must have been cleared.
+  template <typename Operations>
+  bool Write(const Allocator& alloc, const Operations& ops) {
+    assert(state_ == State::kEmpty);
+    pSetState(State::kWriting);
+    num_undo_pages_ = 0;
+    undo_pages_.Clear(alloc);
+    undo_images_.Clear(alloc);
+    for (const auto& op : ops) {
+      bool ok = false;
+      if (op.type == OpType::kInsert) {
+        assert(op.key_value);
+        ok = key_values_.PushBack(alloc, *op.key_value);
+      } else {
+        assert(op.key);
+        ok = keys_.PushBack(alloc, *op.key);
+      }
+      if (!ok || !types_.PushBack(alloc, op.type)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief Flush the written operations, then mark the batch committed and
+  /// flush the mark. The batch is durable once this function returns true.
+  /// table_size and mean_probe_distance are those of the table before the
+  /// batch; they are restored together with the undo images.
+  bool Commit(const SizeType table_size, const float mean_probe_distance) {
+    std::vector<MemoryRange> ranges;
+    for (const auto& range :
+         {types_.Range(), key_values_.Range(), keys_.Range()}) {
+      if (range.length > 0) {
+        ranges.push_back(PageAlignedRange(range.addr, range.length));
+      }
+    }
+    CoalesceMemoryRanges(ranges);
+    if (!SyncMemoryRanges(ranges)) {
+      return false;
+    }
+    table_size_ = table_size;
+    mean_probe_distance_ = mean_probe_distance;
+    pSetState(State::kCommitted);
+    return pFlushHeader();
+  }
+
+  /// \brief Record that the batch is applied without undo images.
+  bool BeginApplying() {
+    assert(state_ == State::kCommitted);
+    pSetState(State::kApplying);
+    return pFlushHeader();
+  }
+
+  /// \brief Apply the logged operations in order.
+  template <typename InsertFunc, typename EraseFunc>
+  void Replay(InsertFunc&& insert, EraseFunc&& erase) const {
+    std::size_t kv_index = 0;
+    std::size_t key_index = 0;
+    for (std::size_t i = 0; i < types_.Size(); ++i) {
+      if (types_[i] == OpType::kInsert) {
+        insert(key_values_[kv_index++]);
+      } else {
+        erase(keys_[key_index++]);
+      }
+    }
+  }
+
+  /// \brief Prepare to record the pages of a table of length bytes.
+  /// No image must have been taken since the commit (see Undo()).
+  bool BeginUndo(const Allocator& alloc, const std::byte* const region,
+                 const SizeType length) {
+    assert(num_undo_pages_ == 0);
+    undo_pages_.Clear(alloc);
+    undo_images_.Clear(alloc);
+    saved_.Clear(alloc);
+    return saved_.Resize(alloc, pNumPages(region, length));
+  }
+
+  /// \brief Record the pages of the table at region that hold
+  /// [addr, addr + n), unless they have been recorded in this batch, and take
+  /// their undo images if image is true.
+  /// The images are not durable until FlushUndo() is called.
+  bool SaveUndo(const Allocator& alloc, const std::byte* const region,
+                const SizeType length, const void* const addr,
+                const SizeType n, const bool image) {
+    const auto page_size = os_page_size();
+    const auto base = pBase(region);
+    const auto* const first = static_cast<const std::byte*>(addr);
+    const auto begin_page = SizeType(first - base) / page_size;
+    const auto end_page = SizeType(first + n - 1 - base) / page_size;
+    for (auto page = begin_page; page <= end_page; ++page) {
+      if (saved_[page]) {
+        continue;
+      }
+      saved_[page] = 1;
+      const auto num_pages = undo_pages_.Size();
+      if (!image) {
+        if (!undo_pages_.PushBack(alloc, page)) {
+          return false;
+        }
+        continue;
+      }
+      if (!undo_pages_.Reserve(alloc, num_pages + 1, true) ||
+          !undo_images_.Reserve(alloc, (num_pages + 1) * page_size, true) ||
+          !undo_pages_.PushBack(alloc, page) ||
+          !undo_images_.Resize(alloc, (num_pages + 1) * page_size)) {
+        return false;
+      }
+      // Only the part of the page inside the table belongs to the table.
+      const auto [begin, end] = pClip(region, length, page);
+      std::memcpy(undo_images_.Data() + num_pages * page_size + begin,
+                  base + page * page_size + begin, end - begin);
+    }
+    return true;
+  }
+
+  /// \brief Make the undo images taken so far durable.
+  bool FlushUndo() {
+    if (num_undo_pages_ == undo_pages_.Size()) {
+      return true;
+    }
+    const auto page_size = os_page_size();
+    const std::vector<MemoryRange> ranges{
+        PageAlignedRange(undo_pages_.Data() + num_undo_pages_,
+                         (undo_pages_.Size() - num_undo_pages_) *
+                             sizeof(SizeType)),
+        PageAlignedRange(undo_images_.Data() + num_undo_pages_ * page_size,
+                         (undo_pages_.Size() - num_undo_pages_) * page_size)};
+    if (!SyncMemoryRanges(ranges)) {
+      return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    num_undo_pages_ = undo_pages_.Size();
+    return pFlushHeader();
+  }
+
+  /// \brief Copy the durable undo images back to the table at region, which
+  /// must be the table the batch was applied to.
+  /// The images are kept until ResetUndo() is called, which the caller must
+  /// do only after the restored table has been flushed.
+  void Undo(std::byte* const region, const SizeType length) const {
+    const auto page_size = os_page_size();
+    for (SizeType i = 0; i < num_undo_pages_; ++i) {
+      const auto [begin, end] = pClip(region, length, undo_pages_[i]);
+      std::memcpy(pBase(region) + undo_pages_[i] * page_size + begin,
+                  undo_images_.Data() + i * page_size + begin, end - begin);
+    }
+  }
+
+  /// \brief Forget the undo images after the table restored by Undo() was
+  /// flushed.
+  bool ResetUndo(const Allocator& alloc) {
+    num_undo_pages_ = 0;
+    undo_pages_.Clear(alloc);
+    undo_images_.Clear(alloc);
+    return pFlushHeader();
+  }
+
+  /// \brief Return the page-aligned ranges of the table at region that were
+  /// modified by the batch, i.e., those recorded by SaveUndo().
+  std::vector<MemoryRange> UndoRanges(const std::byte* const region) const {
+    const auto base = pBase(region);
+    std::vector<MemoryRange> ranges;
+    ranges.reserve(undo_pages_.Size());
+    for (SizeType i = 0; i < undo_pages_.Size(); ++i) {
+      ranges.push_back(MemoryRange{base + undo_pages_[i] * os_page_size(),
+                                   os_page_size()});
+    }
+    CoalesceMemoryRanges(ranges);
+    return ranges;
+  }
+
+  /// \brief Mark the log empty and destroy the logged operations.
+  /// The storage is kept for the next batch.
+  bool Clear(const Allocator& alloc) {
+    pSetState(State::kEmpty);
+    num_undo_pages_ = 0;
+    const bool ret = pFlushHeader();
+    types_.Clear(alloc);
+    key_values_.Clear(alloc);
+    keys_.Clear(alloc);
+    undo_pages_.Clear(alloc);
+    undo_images_.Clear(alloc);
+    return ret;
+  }
+
+  /// \brief Destroy the logged operations and deallocate the storage.
+  void Free(const Allocator& alloc) {
+    types_.Free(alloc);
+    key_values_.Free(alloc);
+    keys_.Free(alloc);
+    undo_pages_.Free(alloc);
+    undo_images_.Free(alloc);
+    saved_.Free(alloc);
+    num_undo_pages_ = 0;
+    state_ = State::kEmpty;
+  }
+
+  inline State GetState() const { return state_; }
+
+  inline std::size_t NumOperations() const { return types_.Size(); }
+
+  /// \brief Return the number of durable undo images.
+  inline SizeType NumUndoPages() const { return num_undo_pages_; }
+
+  /// \brief The size of the table before the batch.
+  inline SizeType TableSize() const { return table_size_; }
+
+  /// \brief The mean probe distance of the table before the batch.
+  inline float MeanProbeDistance() const { return mean_probe_distance_; }
+
+ private:
+  /// The start of the page that holds the first byte of a table.
+  inline static std::byte* pBase(const std::byte* const region) {
+    return PageAlignedRange(region, 1).addr;
+  }
+
+  /// Return the offsets of the first and the last bytes plus one of the
+  /// table in the page.
+  inline static std::pair<SizeType, SizeType> pClip(
+      const std::byte* const region, const SizeType length,
+      const SizeType page) {
+    const std::byte* const page_begin =
+        pBase(region) + page * os_page_size();
+    const auto* const begin = std::max(page_begin, region);
+    const auto* const end =
+        std::min(page_begin + os_page_size(), region + length);
+    return {SizeType(begin - page_begin), SizeType(end - page_begin)};
+  }
+
+  inline static SizeType pNumPages(const std::byte* const region,
+                                   const SizeType length) {
+    return PageAlignedRange(region, length).length / os_page_size();
+  }
+
+  inline void pSetState(const State state) {
+    std::atomic_thread_fence(std::memory_order_release);
+    state_ = state;
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /// Flush the state, the number of undo images, and the headers of the
+  /// arrays.
+  inline bool pFlushHeader() {
+    const auto range = PageAlignedRange(this, sizeof(*this));
+    return os_msync(range.addr, range.length);
+  }
+
+  State state_{State::kEmpty};
+  SizeType num_undo_pages_{0};
+  SizeType table_size_{0};
+  float mean_probe_distance_{0};
+  PersistentArray<OpType, Allocator> types_{};
+  PersistentArray<KeyValueType, Allocator> key_values_{};
+  PersistentArray<KeyType, Allocator> keys_{};
+  PersistentArray<SizeType, Allocator> undo_pages_{};
+  PersistentArray<std::byte, Allocator> undo_images_{};
+  // Whether the image of each table page has been taken in this batch.
+  // Only used while the batch is applied.
+  PersistentArray<uint8_t, Allocator> saved_{};
+};
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,133 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace perroht::prhdtls {
+
+/// \brief A small descriptor that records an in-flight resize of a table.
+/// The descriptor is stored alongside the container (e.g., in a persistent
+/// memory segment) so that a resize interrupted by an abnormal termination can
+/// be rolled back or finished when the container is reopened.
+/// Every state transition is separated by a release fence so that the fields
+/// are written to memory in the order the recovery procedure expects.
+template <typename BytePointer, typename IndexType, typename SizeType>
+class ResizeDescriptor {
+ public:
+  enum class Phase : uint8_t {
+    /// No resize is in progress.
+    kIdle = 0,
+    /// The new table is being built. The old table is still intact.
+    kMigrating = 1,
+    /// The new table is complete. The old table has to be deallocated.
+    kCommitted = 2,
+    /// The table is being resized in place. The table cannot be recovered.
+    kInPlace = 3,
+    /// Entries are being moved from the old table to the new one, leaving
+    /// neither of them complete. The table cannot be recovered.
+    kMoving = 4,
+  };
+
+  ResizeDescriptor() = default;
+
+  /// \brief Record the start of a migration from old_table to new_table.
+  inline void Begin(BytePointer old_table, const IndexType old_capacity_index,
+                    BytePointer new_table,
+                    const IndexType new_capacity_index) noexcept {
+    old_table_ = old_table;
+    old_capacity_index_ = old_capacity_index;
+    new_table_ = new_table;
+    new_capacity_index_ = new_capacity_index;
+    pSetPhase(Phase::kMigrating);
+  }
+
+  /// \brief Record the start of an in-place resize.
+  inline void BeginInPlace() noexcept { pSetPhase(Phase::kInPlace); }
+
+  /// \brief Record the start of a resize that moves the entries out of the
+  /// old table.
+  inline void BeginMove() noexcept { pSetPhase(Phase::kMoving); }
+
+  /// \brief Record that the new table is complete.
+  /// After this call, the new table is the valid one.
+  inline void Commit(const SizeType new_size,
+                     const float new_mean_probe_distance) noexcept {
+    new_size_ = new_size;
+    new_mean_probe_distance_ = new_mean_probe_distance;
+    pSetPhase(Phase::kCommitted);
+  }
+
+  /// \brief Mark the descriptor idle.
+  inline void Clear() noexcept {
+    pSetPhase(Phase::kIdle);
+    old_table_ = nullptr;
+    new_table_ = nullptr;
+    old_capacity_index_ = 0;
+    new_capacity_index_ = 0;
+    new_size_ = 0;
+    new_mean_probe_distance_ = 0;
+  }
+
+  /// \brief Take the old table out of the descriptor.
+  /// The pointer is cleared before it is returned so that the table is never
+  /// deallocated twice, even if the caller is interrupted.
+  inline BytePointer ReleaseOldTable() noexcept {
+    return pRelease(old_table_);
+  }
+
+  /// \brief Take the new table out of the descriptor.
+  /// See ReleaseOldTable().
+  inline BytePointer ReleaseNewTable() noexcept {
+    return pRelease(new_table_);
+  }
+
+  inline Phase GetPhase() const noexcept { return phase_; }
+
+  inline bool Idle() const noexcept { return phase_ == Phase::kIdle; }
+
+  inline BytePointer NewTable() const noexcept { return new_table_; }
+
+  inline IndexType OldCapacityIndex() const noexcept {
+    return old_capacity_index_;
+  }
+
+  inline IndexType NewCapacityIndex() const noexcept {
+    return new_capacity_index_;
+  }
+
+  inline SizeType NewSize() const noexcept { return new_size_; }
+
+  inline float NewMeanProbeDistance() const noexcept {
+    return new_mean_probe_distance_;
+  }
+
+ private:
+  inline void pSetPhase(const Phase phase) noexcept {
+    std::atomic_thread_fence(std::memory_order_release);
+    phase_ = phase;
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  inline static BytePointer pRelease(BytePointer& table) noexcept {
+    BytePointer released = table;
+    table = nullptr;
+    std::atomic_thread_fence(std::memory_order_release);
+    return released;
+  }
+
+  BytePointer old_table_{nullptr};
+  BytePointer new_table_{nullptr};
+  SizeType new_size_{0};
+  float new_mean_probe_distance_{0};
+  IndexType old_capacity_index_{0};
+  IndexType new_capacity_index_{0};
+  Phase phase_{Phase::kIdle};
+};
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,175 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include "memory.hpp"
+#include "mmap.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief Page-granular copy-on-write state of a table shared by a writer
+/// (the container) and a reader (a snapshot view).
+/// Before the writer modifies a page of the table, it copies the page;
+/// the reader reads the copy if one exists and the table otherwise.
+/// Only one writer and one reader may access an instance concurrently.
+/// When the writer replaces or frees the table, it hands the table over to
+/// this class instead of deallocating it, so that the reader keeps a stable
+/// view; the table is deallocated when the reader releases the snapshot.
+/// This class is volatile, i.e., it is allocated in the heap and never
+/// persisted, and is shared by reference counting.
+template <typename ByteAllocator>
+class TableSnapshot {
+ public:
+  using BytePointer = typename AllocTraits<ByteAllocator>::pointer;
+  using SizeType = std::size_t;
+
+  TableSnapshot(const ByteAllocator& alloc, const std::byte* const region,
+                const SizeType length)
+      : allocator_(alloc),
+        region_(region),
+        length_(length),
+        num_pages_((length + os_page_size() - 1) / os_page_size()),
+        states_(new std::atomic<uint8_t>[num_pages_]),
+        copies_(new std::unique_ptr<std::byte[]>[num_pages_]) {
+    for (SizeType i = 0; i < num_pages_; ++i) {
+      states_[i].store(kShared, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  ~TableSnapshot() noexcept {
+    if (owned_table_) {
+      AllocTraits<ByteAllocator>::deallocate(allocator_, owned_table_,
+                                             length_);
+    }
+  }
+
+  TableSnapshot(const TableSnapshot&) = delete;
+  TableSnapshot& operator=(const TableSnapshot&) = delete;
+
+  /// \brief Called by the writer before modifying [addr, addr + length).
+  /// Copies the pages that have not been copied yet.
+  void BeforeWrite(const void* const addr, const SizeType length) {
+    const auto* const first = static_cast<const std::byte*>(addr);
+    assert(first >= region_ && first + length <= region_ + length_);
+    const auto begin_page = SizeType(first - region_) / os_page_size();
+    const auto end_page = SizeType(first + length - 1 - region_) /
+                          os_page_size();
+    for (auto page = begin_page; page <= end_page; ++page) {
+      if (states_[page].load(std::memory_order_relaxed) == kCopied) {
+        continue;
+      }
+      // Readers that read the page after this point retry their read.
+      states_[page].store(kCopying, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      const auto page_length = pPageLength(page);
+      copies_[page].reset(new std::byte[page_length]);
+      std::memcpy(copies_[page].get(), pPageAddress(page), page_length);
+      states_[page].store(kCopied, std::memory_order_release);
+    }
+  }
+
+  /// \brief Called by the writer when the table is no longer used by it.
+  /// The snapshot takes the ownership of the table and deallocates it when
+  /// the snapshot is destroyed.
+  void TakeOwnership(BytePointer table) { owned_table_ = table; }
+
+  /// \brief Read [addr, addr + length) as of the time the snapshot was taken.
+  void Read(const void* const addr, void* const out,
+            const SizeType length) const {
+    const auto* src = static_cast<const std::byte*>(addr);
+    auto* dst = static_cast<std::byte*>(out);
+    auto remaining = length;
+    while (remaining > 0) {
+      const auto page = SizeType(src - region_) / os_page_size();
+      const auto* const page_end = pPageAddress(page) + pPageLength(page);
+      const auto chunk = std::min(remaining, SizeType(page_end - src));
+      pReadInPage(page, src, dst, chunk);
+      src += chunk;
+      dst += chunk;
+      remaining -= chunk;
+    }
+  }
+
+  inline const std::byte* Region() const { return region_; }
+
+  /// \brief Return the number of pages copied so far.
+  SizeType NumCopiedPages() const {
+    SizeType count = 0;
+    for (SizeType i = 0; i < num_pages_; ++i) {
+      count += states_[i].load(std::memory_order_acquire) == kCopied;
+    }
+    return count;
+  }
+
+  inline void Retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+  /// \brief Release a reference.
+  /// \return True if it was the last reference, i.e., the caller has to
+  /// destroy this instance.
+  inline bool Release() {
+    return refs_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  inline bool Shared() const {
+    return refs_.load(std::memory_order_acquire) > 1;
+  }
+
+ private:
+  static constexpr uint8_t kShared = 0;
+  static constexpr uint8_t kCopying = 1;
+  static constexpr uint8_t kCopied = 2;
+
+  inline const std::byte* pPageAddress(const SizeType page) const {
+    return region_ + page * os_page_size();
+  }
+
+  inline SizeType pPageLength(const SizeType page) const {
+    return std::min(os_page_size(), length_ - page * os_page_size());
+  }
+
+  // Seqlock-style read: a read from the table is valid only if the page was
+  // not being copied before and after the read.
+  void pReadInPage(const SizeType page, const std::byte* const src,
+                   std::byte* const dst, const SizeType length) const {
+    while (true) {
+      const auto state = states_[page].load(std::memory_order_acquire);
+      if (state == kCopied) {
+        std::memcpy(dst, copies_[page].get() + (src - pPageAddress(page)),
+                    length);
+        return;
+      }
+      if (state == kShared) {
+        std::memcpy(dst, src, length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (states_[page].load(std::memory_order_relaxed) == kShared) {
+          return;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  ByteAllocator allocator_;
+  const std::byte* region_;
+  SizeType length_;
+  SizeType num_pages_;
+  std::unique_ptr<std::atomic<uint8_t>[]> states_;
+  std::unique_ptr<std::unique_ptr<std::byte[]>[]> copies_;
+  BytePointer owned_table_{nullptr};
+  std::atomic<int> refs_{1};
+};
+
+}  // namespace perroht::prhdtls
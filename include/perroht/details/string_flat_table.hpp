@@ -0,0 +1,538 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "flat_probing.hpp"
+#include "memory.hpp"
+#include "string_key.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief A Robin Hood hash table for string keys.
+/// Each position holds a StringKey, the lower 32 bits of the hash value of
+/// the string, and a value. Strings that do not fit in a StringKey are kept
+/// in a StringArena owned by the table. A probe compares the hash values,
+/// then the lengths and prefixes of the strings; the arena is read only to
+/// confirm a match. Probe distances are derived from the stored hash values,
+/// so strings are never hashed again when FlatProbing rebuilds the table.
+/// Keys are not stored as objects; thus, dereferencing an iterator returns a
+/// pair of a view of the key and a reference to the value.
+/// Empty positions hold a value-initialized value; thus, values must be
+/// default constructible.
+/// \warning Views of long strings refer to the arena; they are invalidated by
+/// an insertion, like iterators.
+template <typename Value, typename Hash, typename Alloc>
+class StringFlatTable {
+ private:
+  struct Entry {
+    StringKey key;
+    uint32_t hash{0};
+    Value value{};
+  };
+
+ public:
+  using KeyType = std::string_view;
+  using ValueType = Value;
+  using Hasher = Hash;
+  using SizeType = std::size_t;
+  using DifferentType = std::ptrdiff_t;
+  using Allocator = RebindAlloc<Alloc, Entry>;
+
+ private:
+  using SelfType = StringFlatTable<Value, Hash, Alloc>;
+  using Pointer = typename AllocTraits<Allocator>::pointer;
+  using ArenaType = StringArena<Alloc>;
+  using ElementType = std::pair<std::string_view, Value>;
+  friend class FlatIterator<SelfType, false>;
+  friend class FlatIterator<SelfType, true>;
+
+ public:
+  template <bool IsConst>
+  using BaseIterator = FlatIterator<SelfType, IsConst>;
+  using Iterator = BaseIterator<false>;
+  using ConstIterator = BaseIterator<true>;
+
+  explicit StringFlatTable(const SizeType capacity = 0,
+                           const float max_load_factor = 0.875,
+                           const Hasher& hash = Hasher(),
+                           const Allocator& alloc = Allocator())
+      : max_load_factor_(FlatCapacity::CleanseMaxLoadFactor(max_load_factor)),
+        allocator_(alloc),
+        hasher_(hash),
+        arena_(typename ArenaType::Allocator(alloc)) {
+    Reserve(capacity);
+  }
+
+  StringFlatTable(const StringFlatTable& other)
+      : StringFlatTable(other,
+                        AllocTraits<Allocator>::
+                            select_on_container_copy_construction(
+                                other.allocator_)) {}
+
+  StringFlatTable(const StringFlatTable& other, const Allocator& alloc)
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(alloc),
+        hasher_(other.hasher_),
+        arena_(other.arena_, typename ArenaType::Allocator(alloc)) {
+    pCopyTable(other);
+  }
+
+  StringFlatTable(StringFlatTable&& other) noexcept
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(std::move(other.allocator_)),
+        hasher_(std::move(other.hasher_)),
+        arena_(std::move(other.arena_)),
+        size_(other.size_),
+        capacity_(other.capacity_),
+        table_(std::move(other.table_)) {
+    other.pForgetTable();
+  }
+
+  StringFlatTable(StringFlatTable&& other, const Allocator& alloc)
+      : max_load_factor_(other.max_load_factor_),
+        allocator_(alloc),
+        hasher_(other.hasher_),
+        arena_(typename ArenaType::Allocator(alloc)) {
+    if (allocator_ == other.allocator_) {
+      arena_ = std::move(other.arena_);
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    } else {
+      ArenaType arena(other.arena_, typename ArenaType::Allocator(alloc));
+      arena_ = std::move(arena);
+      pCopyTable(other);
+    }
+  }
+
+  ~StringFlatTable() noexcept { pDestroyTable(); }
+
+  StringFlatTable& operator=(const StringFlatTable& other) {
+    if (this != &other) {
+      StringFlatTable tmp(other, allocator_);
+      Swap(tmp);
+    }
+    return *this;
+  }
+
+  StringFlatTable& operator=(StringFlatTable&& other) noexcept {
+    if (this != &other) {
+      pDestroyTable();
+      max_load_factor_ = other.max_load_factor_;
+      allocator_ = std::move(other.allocator_);
+      hasher_ = std::move(other.hasher_);
+      arena_ = std::move(other.arena_);
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      table_ = std::move(other.table_);
+      other.pForgetTable();
+    }
+    return *this;
+  }
+
+  Allocator GetAllocator() const { return allocator_; }
+
+  Hasher GetHashFunction() const { return hasher_; }
+
+  // ----- Iterators ----- //
+
+  Iterator Begin() { return Iterator(pFirstPosition(0), this); }
+
+  ConstIterator Begin() const {
+    return ConstIterator(pFirstPosition(0), this);
+  }
+
+  Iterator End() { return Iterator(capacity_, this); }
+
+  ConstIterator End() const { return ConstIterator(capacity_, this); }
+
+  // ----- Capacity ----- //
+
+  SizeType Size() const { return size_; }
+
+  bool Empty() const { return size_ == 0; }
+
+  SizeType MaxSize() const noexcept {
+    return AllocTraits<Allocator>::max_size(allocator_);
+  }
+
+  SizeType Capacity() const { return capacity_; }
+
+  /// \brief Return the number of bytes used by the arena for long strings,
+  /// including the bytes of erased strings.
+  SizeType ArenaSize() const { return arena_.Size(); }
+
+  // ----- Modifiers ----- //
+
+  void Clear() noexcept {
+    for (SizeType pos = 0; pos < capacity_; ++pos) {
+      if (!pEmptyAt(pos)) {
+        pMakeEmpty(pos);
+      }
+    }
+    size_ = 0;
+    arena_.Clear();
+  }
+
+  /// \brief Insert a value constructed from args if there is no element
+  /// with the key.
+  template <typename... Args>
+  std::pair<Iterator, bool> TryEmplace(const KeyType key, Args&&... args) {
+    const auto hash = pHash(key);
+    if (const auto pos = pLocate(key, hash); pos != capacity_) {
+      return {Iterator(pos, this), false};
+    }
+    if (!pEnoughCapacity(size_ + 1, capacity_)) {
+      pRehash(pNextCapacity(size_ + 1));
+    }
+    Entry entry{pStoreKey(key), hash, Value(std::forward<Args>(args)...)};
+    const auto pos =
+        FlatProbing::Place(pSlots(table_, capacity_), std::move(entry));
+    ++size_;
+    return {Iterator(pos, this), true};
+  }
+
+  SizeType Erase(const KeyType key) {
+    const auto pos = pLocate(key, pHash(key));
+    if (pos == capacity_) {
+      return 0;
+    }
+    pEraseAt(pos);
+    return 1;
+  }
+
+  /// \brief Erase the element at the given position.
+  /// \return An iterator to the element that follows the erased one.
+  Iterator Erase(const ConstIterator it) {
+    const auto pos = it.Position();
+    if (pos == capacity_) {
+      return End();
+    }
+    pEraseAt(pos);
+    // pos is checked again as the next element may have moved back into it.
+    return Iterator(pFirstPosition(pos), this);
+  }
+
+  void Swap(StringFlatTable& other) noexcept {
+    using std::swap;
+    if constexpr (AllocTraits<
+                      Allocator>::propagate_on_container_swap::value) {
+      swap(allocator_, other.allocator_);
+    }
+    swap(max_load_factor_, other.max_load_factor_);
+    swap(hasher_, other.hasher_);
+    arena_.Swap(other.arena_);
+    swap(size_, other.size_);
+    swap(capacity_, other.capacity_);
+    swap(table_, other.table_);
+  }
+
+  // ----- Lookup ----- //
+
+  Iterator Find(const KeyType key) {
+    return Iterator(pLocate(key, pHash(key)), this);
+  }
+
+  ConstIterator Find(const KeyType key) const {
+    return ConstIterator(pLocate(key, pHash(key)), this);
+  }
+
+  SizeType Count(const KeyType key) const { return Contains(key) ? 1 : 0; }
+
+  bool Contains(const KeyType key) const {
+    return pLocate(key, pHash(key)) != capacity_;
+  }
+
+  // ----- Hash Policy ----- //
+
+  float LoadFactor() const {
+    return capacity_ == 0 ? 0.0f : float(size_) / float(capacity_);
+  }
+
+  float MaxLoadFactor() const { return max_load_factor_; }
+
+  void MaxLoadFactor(const float max_load_factor) {
+    max_load_factor_ = FlatCapacity::CleanseMaxLoadFactor(max_load_factor);
+    Reserve(Size());
+  }
+
+  /// \brief Make the table large enough to hold n elements without growing.
+  void Reserve(const SizeType n) {
+    if (!pEnoughCapacity(n, capacity_)) {
+      pRehash(pNextCapacity(n));
+    }
+  }
+
+  /// \brief Rebuild the table with at least the given number of positions,
+  /// or the smallest capacity that holds the current elements, whichever is
+  /// larger. The arena is rebuilt without the erased strings.
+  void Rehash(const SizeType capacity) {
+    const auto new_capacity =
+        FlatCapacity::ForRehash(size_, capacity, max_load_factor_);
+    if (new_capacity != capacity_) {
+      pRehash(new_capacity);
+    }
+    if (arena_.Garbage() > 0) {
+      pCompactArena();
+    }
+  }
+
+  template <typename V, typename H, typename A>
+  friend bool operator==(const StringFlatTable<V, H, A>& lhs,
+                         const StringFlatTable<V, H, A>& rhs);
+
+ private:
+  /// The positions of a table for FlatProbing.
+  /// The ideal position of an entry is given by its stored hash value.
+  struct Slots {
+    Entry* table;
+    SizeType capacity;
+
+    SizeType Capacity() const { return capacity; }
+
+    bool Empty(const SizeType pos) const { return table[pos].key.IsEmpty(); }
+
+    SizeType IdealPosition(const Entry& entry) const {
+      return entry.hash & (capacity - 1);
+    }
+
+    SizeType ProbeDistance(const SizeType pos) const {
+      return (pos - table[pos].hash) & (capacity - 1);
+    }
+
+    void Put(const SizeType pos, Entry&& entry, SizeType) const {
+      table[pos] = std::move(entry);
+    }
+
+    void Exchange(const SizeType pos, Entry& entry, SizeType) const {
+      using std::swap;
+      swap(table[pos], entry);
+    }
+
+    void Shift(const SizeType dst, const SizeType src, SizeType) const {
+      table[dst] = std::move(table[src]);
+    }
+
+    void MakeEmpty(const SizeType pos) const {
+      table[pos] = Entry{StringKey::MakeEmpty()};
+    }
+  };
+
+  static Slots pSlots(const Pointer& table, const SizeType capacity) {
+    return Slots{ToAddress(table), capacity};
+  }
+
+  bool pEnoughCapacity(const SizeType n, const SizeType capacity) const {
+    return FlatCapacity::Enough(n, capacity, max_load_factor_);
+  }
+
+  SizeType pNextCapacity(const SizeType n) const {
+    const auto capacity = FlatCapacity::Next(n, max_load_factor_);
+    // Positions are derived from 32-bit hash values.
+    assert(capacity == 0 ||
+           capacity - 1 <= std::numeric_limits<uint32_t>::max());
+    return capacity;
+  }
+
+  uint32_t pHash(const KeyType key) const { return uint32_t(hasher_(key)); }
+
+  /// Return the first position at or after pos that holds an element, or
+  /// capacity_.
+  SizeType pFirstPosition(const SizeType pos) const {
+    return FlatProbing::FirstOccupied(pSlots(table_, capacity_), pos);
+  }
+
+  SizeType pNextPosition(const SizeType pos) const {
+    return pFirstPosition(pos + 1);
+  }
+
+  std::pair<std::string_view, Value&> pElementAt(const SizeType pos) {
+    auto& entry = ToAddress(table_)[pos];
+    return {pView(entry), entry.value};
+  }
+
+  std::pair<std::string_view, const Value&> pElementAt(
+      const SizeType pos) const {
+    const auto& entry = ToAddress(table_)[pos];
+    return {pView(entry), entry.value};
+  }
+
+  bool pEmptyAt(const SizeType pos) const {
+    return ToAddress(table_)[pos].key.IsEmpty();
+  }
+
+  std::string_view pView(const Entry& entry) const {
+    return entry.key.View(arena_.Data());
+  }
+
+  /// Make the key of a new element, appending a long string to the arena.
+  StringKey pStoreKey(const KeyType key) {
+    if (key.size() <= StringKey::kInlineCapacity) {
+      return StringKey::MakeInline(key);
+    }
+    return StringKey::Make(key, arena_.Append(key));
+  }
+
+  /// Locate the element with the key in the table.
+  /// Return capacity_ if it is not found.
+  SizeType pLocate(const KeyType key, const uint32_t hash) const {
+    if (capacity_ == 0) {
+      return capacity_;
+    }
+    const auto probe = StringKey::Make(key, 0);
+    const auto* const arena = arena_.Data();
+    const auto slots = pSlots(table_, capacity_);
+    return FlatProbing::Locate(
+        slots, hash & (capacity_ - 1), [&](const SizeType pos) {
+          const auto& slot = slots.table[pos];
+          return slot.hash == hash && slot.key.Matches(probe, key, arena);
+        });
+  }
+
+  /// Erase the element at the given position and release the bytes of its
+  /// string in the arena.
+  void pEraseAt(const SizeType pos) {
+    const auto& key = ToAddress(table_)[pos].key;
+    if (key.IsLong()) {
+      arena_.Release(key.Length());
+    }
+    FlatProbing::Erase(pSlots(table_, capacity_), pos);
+    --size_;
+  }
+
+  void pMakeEmpty(const SizeType pos) {
+    ToAddress(table_)[pos] = Entry{StringKey::MakeEmpty()};
+  }
+
+  Pointer pAllocateTable(const SizeType capacity) {
+    auto table = AllocTraits<Allocator>::allocate(allocator_, capacity);
+    if (!table) {
+      assert(false);
+      std::abort();
+    }
+    auto* const raw = ToAddress(table);
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      AllocTraits<Allocator>::construct(allocator_, raw + pos,
+                                        Entry{StringKey::MakeEmpty()});
+    }
+    return table;
+  }
+
+  void pDeallocateTable(Pointer table, const SizeType capacity) {
+    if (!table) {
+      return;
+    }
+    auto* const raw = ToAddress(table);
+    for (SizeType pos = 0; pos < capacity; ++pos) {
+      AllocTraits<Allocator>::destroy(allocator_, raw + pos);
+    }
+    AllocTraits<Allocator>::deallocate(allocator_, table, capacity);
+  }
+
+  void pDestroyTable() {
+    pDeallocateTable(table_, capacity_);
+    pForgetTable();
+  }
+
+  void pForgetTable() {
+    table_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+  }
+
+  /// Move the elements to a new table of the given capacity.
+  /// If more than half of the arena holds erased strings, the arena is
+  /// rebuilt as well.
+  void pRehash(const SizeType new_capacity) {
+    assert(pEnoughCapacity(size_, new_capacity));
+    Pointer new_table = nullptr;
+    if (new_capacity > 0) {
+      new_table = pAllocateTable(new_capacity);
+      auto* const table = ToAddress(table_);
+      for (SizeType pos = 0; pos < capacity_; ++pos) {
+        if (!table[pos].key.IsEmpty()) {
+          FlatProbing::Place(pSlots(new_table, new_capacity),
+                             std::move(table[pos]));
+        }
+      }
+    }
+    pDeallocateTable(table_, capacity_);
+    table_ = new_table;
+    capacity_ = new_capacity;
+    if (arena_.Garbage() * 2 > arena_.Size()) {
+      pCompactArena();
+    }
+  }
+
+  /// Copy the long strings in use to a new arena and point the keys to it.
+  void pCompactArena() {
+    ArenaType arena(arena_.GetAllocator());
+    arena.Reserve(arena_.Size() - arena_.Garbage());
+    auto* const table = ToAddress(table_);
+    for (SizeType pos = 0; pos < capacity_; ++pos) {
+      auto& key = table[pos].key;
+      if (key.IsLong()) {
+        key.Relocate(arena.Append(key.View(arena_.Data())));
+      }
+    }
+    arena_ = std::move(arena);
+  }
+
+  /// Copy the table of other, keeping the positions of the elements.
+  /// The arena must have been copied already.
+  void pCopyTable(const StringFlatTable& other) {
+    if (other.capacity_ == 0) {
+      return;
+    }
+    table_ = AllocTraits<Allocator>::allocate(allocator_, other.capacity_);
+    if (!table_) {
+      assert(false);
+      std::abort();
+    }
+    auto* const dst = ToAddress(table_);
+    const auto* const src = ToAddress(other.table_);
+    for (SizeType pos = 0; pos < other.capacity_; ++pos) {
+      AllocTraits<Allocator>::construct(allocator_, dst + pos, src[pos]);
+    }
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+  }
+
+  float max_load_factor_{0.875};
+  Allocator allocator_{};
+  Hasher hasher_{};
+  ArenaType arena_;
+  SizeType size_{0};
+  SizeType capacity_{0};
+  Pointer table_{nullptr};
+};
+
+template <typename Value, typename Hash, typename Alloc>
+bool operator==(const StringFlatTable<Value, Hash, Alloc>& lhs,
+                const StringFlatTable<Value, Hash, Alloc>& rhs) {
+  return EqualFlatTables(lhs, rhs,
+                         [](const auto& element) { return element.first; });
+}
+
+template <typename Value, typename Hash, typename Alloc>
+bool operator!=(const StringFlatTable<Value, Hash, Alloc>& lhs,
+                const StringFlatTable<Value, Hash, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht::prhdtls
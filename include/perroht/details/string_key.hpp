@@ -0,0 +1,298 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#include "memory.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief A string key that fits in 24 bytes.
+/// A string of up to kInlineCapacity bytes is stored inline, zero padded,
+/// and its length is stored in the last byte. A longer string is stored in a
+/// StringArena; the key holds the offset of the string in the arena, its
+/// length, and its first kPrefixLength bytes, and the last byte is kLongTag.
+/// Thus, the last 16 bytes of a key hold its length and prefix in both cases,
+/// and most mismatches are found by comparing them, without reading the
+/// arena. Keys are trivially copyable and hold no pointers; they can be
+/// stored in persistent memory.
+class StringKey {
+ public:
+  static constexpr std::size_t kSize = 24;
+  static constexpr std::size_t kInlineCapacity = kSize - 1;
+  static constexpr std::size_t kPrefixLength = 11;
+
+  /// Make a key that marks an empty position in a table.
+  static StringKey MakeEmpty() {
+    StringKey key;
+    key.bytes_[kTagIndex] = char(kEmptyTag);
+    return key;
+  }
+
+  /// Make a key of str, which must fit inline.
+  static StringKey MakeInline(const std::string_view str) {
+    assert(str.size() <= kInlineCapacity);
+    StringKey key;
+    if (!str.empty()) {
+      std::memcpy(key.bytes_, str.data(), str.size());
+    }
+    key.bytes_[kTagIndex] = char(str.size());
+    return key;
+  }
+
+  /// Make a key of str, which is stored at the offset in an arena.
+  /// offset is ignored when str fits inline.
+  static StringKey Make(const std::string_view str, const uint64_t offset) {
+    if (str.size() <= kInlineCapacity) {
+      return MakeInline(str);
+    }
+    assert(str.size() <= std::numeric_limits<uint32_t>::max());
+    StringKey key;
+    const auto length = uint32_t(str.size());
+    std::memcpy(key.bytes_ + kOffsetIndex, &offset, sizeof(offset));
+    std::memcpy(key.bytes_ + kLengthIndex, &length, sizeof(length));
+    std::memcpy(key.bytes_ + kPrefixIndex, str.data(), kPrefixLength);
+    key.bytes_[kTagIndex] = char(kLongTag);
+    return key;
+  }
+
+  bool IsEmpty() const { return pTag() == kEmptyTag; }
+
+  /// True if the string is stored in an arena.
+  bool IsLong() const { return pTag() == kLongTag; }
+
+  std::size_t Length() const {
+    if (!IsLong()) {
+      return pTag();
+    }
+    uint32_t length;
+    std::memcpy(&length, bytes_ + kLengthIndex, sizeof(length));
+    return length;
+  }
+
+  /// The offset of a long string in the arena.
+  uint64_t Offset() const {
+    assert(IsLong());
+    uint64_t offset;
+    std::memcpy(&offset, bytes_ + kOffsetIndex, sizeof(offset));
+    return offset;
+  }
+
+  /// Point a long key to a new offset in the arena.
+  void Relocate(const uint64_t offset) {
+    assert(IsLong());
+    std::memcpy(bytes_ + kOffsetIndex, &offset, sizeof(offset));
+  }
+
+  /// Return the string; arena is the data of the arena that holds long
+  /// strings.
+  std::string_view View(const char* const arena) const {
+    assert(!IsEmpty());
+    if (!IsLong()) {
+      return {bytes_, pTag()};
+    }
+    return {arena + Offset(), Length()};
+  }
+
+  /// Return true if the string equals str, where probe is the key made from
+  /// str by Make() (its offset is not used).
+  /// The lengths and prefixes are compared first; the rest of a long string
+  /// is read from the arena only if they match.
+  bool Matches(const StringKey& probe, const std::string_view str,
+               const char* const arena) const {
+    if (pLoadWord(kHeadIndex) != probe.pLoadWord(kHeadIndex) ||
+        pLoadWord(kHeadIndex + 8) != probe.pLoadWord(kHeadIndex + 8)) {
+      return false;
+    }
+    if (!IsLong()) {
+      return pLoadWord(0) == probe.pLoadWord(0);
+    }
+    return std::memcmp(arena + Offset() + kPrefixLength,
+                       str.data() + kPrefixLength,
+                       str.size() - kPrefixLength) == 0;
+  }
+
+ private:
+  static constexpr uint8_t kLongTag = 0xFF;
+  static constexpr uint8_t kEmptyTag = 0xFE;
+  static constexpr std::size_t kOffsetIndex = 0;
+  static constexpr std::size_t kLengthIndex = 8;
+  static constexpr std::size_t kPrefixIndex = 12;
+  static constexpr std::size_t kHeadIndex = 8;  // Length and prefix
+  static constexpr std::size_t kTagIndex = kSize - 1;
+  static_assert(kPrefixIndex + kPrefixLength == kTagIndex);
+  static_assert(kInlineCapacity < kEmptyTag);
+
+  uint8_t pTag() const { return uint8_t(bytes_[kTagIndex]); }
+
+  uint64_t pLoadWord(const std::size_t index) const {
+    uint64_t word;
+    std::memcpy(&word, bytes_ + index, sizeof(word));
+    return word;
+  }
+
+  alignas(8) char bytes_[kSize]{};
+};
+
+static_assert(sizeof(StringKey) == StringKey::kSize);
+
+/// \brief An append-only buffer of strings that do not fit in a StringKey.
+/// Strings are referred to by their offsets; the buffer is referred to with
+/// the allocator's pointer type. Thus, the offsets stay valid when the buffer
+/// is reallocated, and the arena can be stored in persistent memory.
+/// Erased strings are only counted; their space is reclaimed by rebuilding
+/// the arena (see StringFlatTable).
+template <typename Alloc>
+class StringArena {
+ public:
+  using Allocator = RebindAlloc<Alloc, char>;
+  using SizeType = std::size_t;
+
+ private:
+  using Pointer = typename AllocTraits<Allocator>::pointer;
+
+ public:
+  explicit StringArena(const Allocator& alloc = Allocator())
+      : allocator_(alloc) {}
+
+  StringArena(const StringArena& other, const Allocator& alloc)
+      : allocator_(alloc) {
+    Reserve(other.size_);
+    if (other.size_ > 0) {
+      std::memcpy(ToAddress(data_), ToAddress(other.data_), other.size_);
+    }
+    size_ = other.size_;
+    garbage_ = other.garbage_;
+  }
+
+  StringArena(StringArena&& other) noexcept
+      : allocator_(std::move(other.allocator_)),
+        data_(std::move(other.data_)),
+        capacity_(other.capacity_),
+        size_(other.size_),
+        garbage_(other.garbage_) {
+    other.pForget();
+  }
+
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  StringArena& operator=(StringArena&& other) noexcept {
+    if (this != &other) {
+      pDeallocate();
+      allocator_ = std::move(other.allocator_);
+      data_ = std::move(other.data_);
+      capacity_ = other.capacity_;
+      size_ = other.size_;
+      garbage_ = other.garbage_;
+      other.pForget();
+    }
+    return *this;
+  }
+
+  ~StringArena() noexcept { pDeallocate(); }
+
+  const Allocator& GetAllocator() const { return allocator_; }
+
+  const char* Data() const { return data_ ? ToAddress(data_) : nullptr; }
+
+  /// The number of bytes in use, including erased strings.
+  SizeType Size() const { return size_; }
+
+  /// The number of bytes of erased strings.
+  SizeType Garbage() const { return garbage_; }
+
+  /// Make room for n bytes in total.
+  void Reserve(const SizeType n) {
+    if (n <= capacity_) {
+      return;
+    }
+    if (data_ && ExpandInPlace(allocator_, data_, capacity_, n)) {
+      capacity_ = n;
+      return;
+    }
+    Pointer data = AllocTraits<Allocator>::allocate(allocator_, n);
+    if (!data) {
+      std::abort();
+    }
+    if (size_ > 0) {
+      std::memcpy(ToAddress(data), ToAddress(data_), size_);
+    }
+    if (data_) {
+      AllocTraits<Allocator>::deallocate(allocator_, data_, capacity_);
+    }
+    data_ = data;
+    capacity_ = n;
+  }
+
+  /// Append str and return its offset.
+  /// str must not refer to the arena.
+  uint64_t Append(const std::string_view str) {
+    if (size_ + str.size() > capacity_) {
+      Reserve(std::max(size_ + str.size(), capacity_ * 2));
+    }
+    const auto offset = size_;
+    std::memcpy(ToAddress(data_) + offset, str.data(), str.size());
+    size_ += str.size();
+    return offset;
+  }
+
+  /// Count n bytes of an erased string as garbage.
+  void Release(const SizeType n) {
+    garbage_ += n;
+    assert(garbage_ <= size_);
+  }
+
+  /// Forget all strings, keeping the buffer.
+  void Clear() {
+    size_ = 0;
+    garbage_ = 0;
+  }
+
+  void Swap(StringArena& other) noexcept {
+    using std::swap;
+    if constexpr (AllocTraits<
+                      Allocator>::propagate_on_container_swap::value) {
+      swap(allocator_, other.allocator_);
+    }
+    swap(data_, other.data_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(garbage_, other.garbage_);
+  }
+
+ private:
+  void pDeallocate() {
+    if (data_) {
+      AllocTraits<Allocator>::deallocate(allocator_, data_, capacity_);
+    }
+    pForget();
+  }
+
+  void pForget() {
+    data_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    garbage_ = 0;
+  }
+
+  Allocator allocator_{};
+  Pointer data_{nullptr};
+  SizeType capacity_{0};
+  SizeType size_{0};
+  SizeType garbage_{0};
+};
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,52 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace perroht::prhdtls {
+
+/// \brief True if an instance of T can be duplicated by copying its bytes.
+/// Unlike std::is_trivially_copyable, std::pair of such types is also
+/// bitwise copyable, although std::pair has user-provided assignment
+/// operators.
+template <typename T>
+struct IsBitwiseCopyable : std::is_trivially_copyable<T> {};
+
+template <typename T1, typename T2>
+struct IsBitwiseCopyable<std::pair<T1, T2>>
+    : std::bool_constant<IsBitwiseCopyable<std::remove_const_t<T1>>::value &&
+                         IsBitwiseCopyable<T2>::value> {};
+
+template <typename T>
+inline constexpr bool IsBitwiseCopyableV = IsBitwiseCopyable<T>::value;
+
+}  // namespace perroht::prhdtls
+
+namespace perroht {
+
+/// \brief True if an object of type T can be moved to another address by
+/// copying its bytes, after which the source object is not destroyed.
+/// Perroht moves such embedded elements with memcpy and memmove when it
+/// displaces, shifts, and transfers them. True for bitwise copyable types by
+/// default; specialize it for other types that qualify, e.g., a type that
+/// holds a std::unique_ptr. Types that point into themselves, e.g.,
+/// std::string of libstdc++, do not qualify.
+template <typename T>
+struct IsTriviallyRelocatable : prhdtls::IsBitwiseCopyable<T> {};
+
+template <typename T1, typename T2>
+struct IsTriviallyRelocatable<std::pair<T1, T2>>
+    : std::bool_constant<
+          IsTriviallyRelocatable<std::remove_const_t<T1>>::value &&
+          IsTriviallyRelocatable<T2>::value> {};
+
+template <typename T>
+inline constexpr bool IsTriviallyRelocatableV =
+    IsTriviallyRelocatable<T>::value;
+
+}  // namespace perroht
@@ -0,0 +1,129 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dirty_page_map.hpp"
+#include "mmap.hpp"
+
+namespace perroht::prhdtls {
+
+/// \brief Runs a list of warm-up jobs, e.g., prefaulting the pages of a
+/// table, on background threads.
+/// Jobs are taken in order; thus, jobs that come first are done first.
+/// Destroying an instance cancels the remaining jobs and waits for the
+/// running ones.
+class WarmUpTask {
+ public:
+  using SizeType = std::size_t;
+  using Job = std::function<void()>;
+
+  /// The number of bytes each job added by AddPrefaultJobs() prefaults.
+  static constexpr SizeType kChunkSize = SizeType(1) << 20;
+
+  WarmUpTask(std::vector<Job> jobs, const SizeType num_threads)
+      : jobs_(std::move(jobs)) {
+    const auto n = std::max(SizeType(1), std::min(num_threads, jobs_.size()));
+    for (SizeType i = 0; i < n && !jobs_.empty(); ++i) {
+      threads_.emplace_back([this]() { pRun(); });
+    }
+  }
+
+  ~WarmUpTask() noexcept {
+    Cancel();
+    Wait();
+  }
+
+  WarmUpTask(const WarmUpTask&) = delete;
+  WarmUpTask& operator=(const WarmUpTask&) = delete;
+
+  /// \brief Return the fraction of the jobs done, from 0.0 to 1.0.
+  double Progress() const {
+    if (jobs_.empty()) {
+      return 1.0;
+    }
+    return double(num_done_.load(std::memory_order_relaxed)) /
+           double(jobs_.size());
+  }
+
+  /// \brief Return true if all jobs have been done.
+  bool Done() const {
+    return num_done_.load(std::memory_order_acquire) == jobs_.size();
+  }
+
+  /// \brief Wait until all jobs have been done or canceled.
+  void Wait() {
+    for (auto& thread : threads_) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  }
+
+  /// \brief Skip the jobs that have not been started yet.
+  void Cancel() { canceled_.store(true, std::memory_order_relaxed); }
+
+  /// \brief Add jobs that prefault [addr, addr + length), one per
+  /// kChunkSize bytes.
+  static void AddPrefaultJobs(const void* const addr, const SizeType length,
+                              std::vector<Job>& jobs) {
+    const auto* const begin = static_cast<const std::byte*>(addr);
+    for (SizeType offset = 0; offset < length; offset += kChunkSize) {
+      const auto chunk = std::min(kChunkSize, length - offset);
+      jobs.emplace_back([begin, offset, chunk]() {
+        const auto range = PageAlignedRange(begin + offset, chunk);
+        // Let the kernel read the chunk ahead, then fault in each page.
+        os_madvise(range.addr, range.length, MADV_WILLNEED);
+        TouchPages(begin + offset, chunk);
+      });
+    }
+  }
+
+  /// \brief Read a byte from each page in [addr, addr + length).
+  static void TouchPages(const void* const addr, const SizeType length) {
+    if (length == 0) {
+      return;
+    }
+    const auto* const begin = static_cast<const volatile std::byte*>(addr);
+    const auto page_size = os_page_size();
+    const auto first_page = reinterpret_cast<uintptr_t>(begin) / page_size;
+    const auto last_page =
+        (reinterpret_cast<uintptr_t>(begin) + length - 1) / page_size;
+    // Read the first byte of the range and of each following page.
+    (void)*begin;
+    for (auto page = first_page + 1; page <= last_page; ++page) {
+      (void)*reinterpret_cast<const volatile std::byte*>(page * page_size);
+    }
+  }
+
+ private:
+  void pRun() {
+    while (!canceled_.load(std::memory_order_relaxed)) {
+      const auto i = next_.fetch_add(1, std::memory_order_relaxed);
+      if (i >= jobs_.size()) {
+        break;
+      }
+      jobs_[i]();
+      num_done_.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  std::vector<Job> jobs_;
+  std::vector<std::thread> threads_{};
+  std::atomic<SizeType> next_{0};
+  std::atomic<SizeType> num_done_{0};
+  std::atomic<bool> canceled_{false};
+};
+
+}  // namespace perroht::prhdtls
@@ -0,0 +1,185 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "details/int_flat_table.hpp"
+
+namespace perroht {
+
+/// \brief A flat map for integer keys whose table has no header bytes.
+/// The largest key value marks empty positions (an element with that key is
+/// kept aside); probe distances are derived from the hash values. Thus,
+/// elements are stored densely and aligned, and a probe loads the elements
+/// only. Follows the same Robin Hood hashing scheme as Perroht and can be
+/// stored in persistent memory with a persistent allocator.
+/// \warning Values must be default constructible.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class int_flat_map {
+ private:
+  using ImplType = prhdtls::IntFlatTable<Key, T, Hash, Allocator>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = typename ImplType::KeyValueType;
+  using size_type = typename ImplType::SizeType;
+  using difference_type = typename ImplType::DifferentType;
+  using hasher = Hash;
+  using key_equal = std::equal_to<Key>;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename ImplType::Iterator;
+  using const_iterator = typename ImplType::ConstIterator;
+
+  int_flat_map() : impl_() {}
+
+  explicit int_flat_map(size_type n, const Hash& hash = Hash(),
+                        const allocator_type& alloc = allocator_type())
+      : impl_(n, 0.875, hash, alloc) {}
+
+  explicit int_flat_map(const allocator_type& alloc)
+      : impl_(0, 0.875, Hash(), alloc) {}
+
+  int_flat_map(const int_flat_map& other) = default;
+  int_flat_map(int_flat_map&& other) noexcept = default;
+
+  int_flat_map(const int_flat_map& other, const allocator_type& alloc)
+      : impl_(other.impl_, alloc) {}
+
+  int_flat_map(int_flat_map&& other, const allocator_type& alloc)
+      : impl_(std::move(other.impl_), alloc) {}
+
+  ~int_flat_map() = default;
+
+  int_flat_map& operator=(const int_flat_map& other) = default;
+  int_flat_map& operator=(int_flat_map&& other) noexcept = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(impl_.GetAllocator());
+  }
+
+  // ----- Iterators ----- //
+
+  iterator begin() noexcept { return impl_.Begin(); }
+
+  const_iterator begin() const noexcept { return impl_.Begin(); }
+
+  const_iterator cbegin() const noexcept { return impl_.Begin(); }
+
+  iterator end() noexcept { return impl_.End(); }
+
+  const_iterator end() const noexcept { return impl_.End(); }
+
+  const_iterator cend() const noexcept { return impl_.End(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return impl_.Empty(); }
+
+  size_type size() const noexcept { return impl_.Size(); }
+
+  size_type max_size() const noexcept { return impl_.MaxSize(); }
+
+  // ----- Modifiers ----- //
+
+  void clear() noexcept { impl_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return impl_.Insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return impl_.Insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return impl_.Emplace(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return impl_.TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key& key) { return impl_.Erase(key); }
+
+  iterator erase(const_iterator pos) { return impl_.Erase(pos); }
+
+  void swap(int_flat_map& other) noexcept { impl_.Swap(other.impl_); }
+
+  // ----- Lookup ----- //
+
+  T& at(const Key& key) {
+    return const_cast<T&>(const_cast<const int_flat_map*>(this)->at(key));
+  }
+
+  const T& at(const Key& key) const {
+    const auto it = impl_.Find(key);
+    if (it == impl_.End()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return impl_.TryEmplace(key).first->second; }
+
+  size_type count(const Key& key) const { return impl_.Count(key); }
+
+  iterator find(const Key& key) { return impl_.Find(key); }
+
+  const_iterator find(const Key& key) const { return impl_.Find(key); }
+
+  bool contains(const Key& key) const { return impl_.Contains(key); }
+
+  // ----- Bucket Interface ----- //
+
+  size_type bucket_count() const noexcept { return impl_.Capacity(); }
+
+  // ----- Hash Policy ----- //
+
+  float load_factor() const noexcept { return impl_.LoadFactor(); }
+
+  float max_load_factor() const noexcept { return impl_.MaxLoadFactor(); }
+
+  void max_load_factor(const float ml) { impl_.MaxLoadFactor(ml); }
+
+  void rehash(size_type count) { impl_.Rehash(count); }
+
+  void reserve(size_type count) { impl_.Reserve(count); }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return impl_.GetHashFunction(); }
+
+  key_equal key_eq() const { return key_equal(); }
+
+  friend bool operator==(const int_flat_map& lhs, const int_flat_map& rhs) {
+    return lhs.impl_ == rhs.impl_;
+  }
+
+  friend bool operator!=(const int_flat_map& lhs, const int_flat_map& rhs) {
+    return lhs.impl_ != rhs.impl_;
+  }
+
+ private:
+  ImplType impl_;
+};
+
+template <typename Key, typename T, typename Hash, typename Allocator>
+void swap(int_flat_map<Key, T, Hash, Allocator>& lhs,
+          int_flat_map<Key, T, Hash, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace perroht
@@ -0,0 +1,149 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "details/int_flat_table.hpp"
+
+namespace perroht {
+
+/// \brief A flat set of integers whose table has no header bytes.
+/// See int_flat_map.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename Allocator = std::allocator<Key>>
+class int_flat_set {
+ private:
+  using ImplType = prhdtls::IntFlatTable<Key, VoidValue, Hash, Allocator>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = typename ImplType::SizeType;
+  using difference_type = typename ImplType::DifferentType;
+  using hasher = Hash;
+  using key_equal = std::equal_to<Key>;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename ImplType::ConstIterator;
+  using const_iterator = typename ImplType::ConstIterator;
+
+  int_flat_set() : impl_() {}
+
+  explicit int_flat_set(size_type n, const Hash& hash = Hash(),
+                        const allocator_type& alloc = allocator_type())
+      : impl_(n, 0.875, hash, alloc) {}
+
+  explicit int_flat_set(const allocator_type& alloc)
+      : impl_(0, 0.875, Hash(), alloc) {}
+
+  int_flat_set(const int_flat_set& other) = default;
+  int_flat_set(int_flat_set&& other) noexcept = default;
+
+  int_flat_set(const int_flat_set& other, const allocator_type& alloc)
+      : impl_(other.impl_, alloc) {}
+
+  int_flat_set(int_flat_set&& other, const allocator_type& alloc)
+      : impl_(std::move(other.impl_), alloc) {}
+
+  ~int_flat_set() = default;
+
+  int_flat_set& operator=(const int_flat_set& other) = default;
+  int_flat_set& operator=(int_flat_set&& other) noexcept = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(impl_.GetAllocator());
+  }
+
+  // ----- Iterators ----- //
+
+  const_iterator begin() const noexcept { return impl_.Begin(); }
+
+  const_iterator cbegin() const noexcept { return impl_.Begin(); }
+
+  const_iterator end() const noexcept { return impl_.End(); }
+
+  const_iterator cend() const noexcept { return impl_.End(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return impl_.Empty(); }
+
+  size_type size() const noexcept { return impl_.Size(); }
+
+  size_type max_size() const noexcept { return impl_.MaxSize(); }
+
+  // ----- Modifiers ----- //
+
+  void clear() noexcept { impl_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return impl_.Insert(value);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return impl_.Emplace(std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key& key) { return impl_.Erase(key); }
+
+  iterator erase(const_iterator pos) { return impl_.Erase(pos); }
+
+  void swap(int_flat_set& other) noexcept { impl_.Swap(other.impl_); }
+
+  // ----- Lookup ----- //
+
+  size_type count(const Key& key) const { return impl_.Count(key); }
+
+  const_iterator find(const Key& key) const { return impl_.Find(key); }
+
+  bool contains(const Key& key) const { return impl_.Contains(key); }
+
+  // ----- Bucket Interface ----- //
+
+  size_type bucket_count() const noexcept { return impl_.Capacity(); }
+
+  // ----- Hash Policy ----- //
+
+  float load_factor() const noexcept { return impl_.LoadFactor(); }
+
+  float max_load_factor() const noexcept { return impl_.MaxLoadFactor(); }
+
+  void max_load_factor(const float ml) { impl_.MaxLoadFactor(ml); }
+
+  void rehash(size_type count) { impl_.Rehash(count); }
+
+  void reserve(size_type count) { impl_.Reserve(count); }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return impl_.GetHashFunction(); }
+
+  key_equal key_eq() const { return key_equal(); }
+
+  friend bool operator==(const int_flat_set& lhs, const int_flat_set& rhs) {
+    return lhs.impl_ == rhs.impl_;
+  }
+
+  friend bool operator!=(const int_flat_set& lhs, const int_flat_set& rhs) {
+    return lhs.impl_ != rhs.impl_;
+  }
+
+ private:
+  ImplType impl_;
+};
+
+template <typename Key, typename Hash, typename Allocator>
+void swap(int_flat_set<Key, Hash, Allocator>& lhs,
+          int_flat_set<Key, Hash, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace perroht
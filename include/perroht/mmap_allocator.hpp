@@ -0,0 +1,298 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "details/file.hpp"
+#include "details/mmap.hpp"
+#include "details/mmap_heap.hpp"
+
+namespace perroht {
+
+/// \brief A lightweight persistent memory segment backed by a sparse file.
+/// The file is mapped at the same virtual address every time it is opened,
+/// so that containers can be stored in the segment with raw pointers.
+/// A large virtual address range is reserved when the segment is opened and
+/// the file is mapped at its beginning; the segment grows in place by
+/// extending the file and mapping the new part right after the existing one.
+/// Objects can be registered with a name to find them after reopening.
+///
+/// \code
+/// perroht::mmap_segment segment("/path/to/file", perroht::create_only);
+/// using Alloc = perroht::mmap_allocator<std::pair<int, int>>;
+/// using Map = perroht::Perroht<int, int, std::hash<int>,
+///                              std::equal_to<int>, true, Alloc>;
+/// auto* map = segment.construct<Map>("map", Alloc(segment));
+/// \endcode
+class mmap_segment {
+ public:
+  struct create_only_t {};
+  struct open_only_t {};
+
+  /// \brief Create a new segment, truncating the file if it exists.
+  /// \param reserved_size The maximum size of the segment.
+  mmap_segment(const std::string& path, create_only_t,
+               const std::size_t reserved_size = kDefaultReservedSize) {
+    pCreate(path, reserved_size);
+  }
+
+  /// \brief Open an existing segment.
+  mmap_segment(const std::string& path, open_only_t) { pOpen(path); }
+
+  ~mmap_segment() noexcept { pClose(); }
+
+  mmap_segment(const mmap_segment&) = delete;
+  mmap_segment& operator=(const mmap_segment&) = delete;
+
+  /// \brief Return true if the segment was created or opened successfully.
+  bool good() const noexcept { return heap_ != nullptr; }
+
+  /// \brief Construct an object in the segment and register it with the
+  /// given name.
+  /// \return A pointer to the object, or nullptr if the name is already used
+  /// or there is no space.
+  template <typename T, typename... Args>
+  T* construct(const char* const name, Args&&... args) {
+    if (!good() || heap_->Find(name)) return nullptr;
+    void* const addr = heap_->Allocate(sizeof(T), alignof(T));
+    if (!addr) return nullptr;
+    auto* const obj = new (addr) T(std::forward<Args>(args)...);
+    if (!heap_->Register(name, obj)) {
+      obj->~T();
+      heap_->Deallocate(addr, sizeof(T), alignof(T));
+      return nullptr;
+    }
+    return obj;
+  }
+
+  /// \brief Return the object registered with the given name, or nullptr.
+  template <typename T>
+  T* find(const char* const name) const {
+    return good() ? static_cast<T*>(heap_->Find(name)) : nullptr;
+  }
+
+  /// \brief Destroy the object registered with the given name.
+  template <typename T>
+  bool destroy(const char* const name) {
+    T* const obj = find<T>(name);
+    if (!obj) return false;
+    heap_->Unregister(name);
+    obj->~T();
+    heap_->Deallocate(obj, sizeof(T), alignof(T));
+    return true;
+  }
+
+  /// \brief Flush the whole segment to the file.
+  bool flush() {
+    return good() && prhdtls::os_msync(heap_, heap_->mapped_size);
+  }
+
+  /// \brief Return the current size of the backing file.
+  std::size_t size() const { return good() ? heap_->mapped_size : 0; }
+
+  /// \brief Return the heap of the segment. Used by mmap_allocator.
+  prhdtls::MmapHeap* heap() const noexcept { return heap_; }
+
+ private:
+  static constexpr std::size_t kDefaultReservedSize = std::size_t(1) << 36;
+
+  static bool pGrow(void* const context, const std::size_t new_size) {
+    auto* const self = static_cast<mmap_segment*>(context);
+    const auto old_size = self->heap_->mapped_size;
+    if (::ftruncate(self->fd_, off_t(new_size)) != 0) return false;
+    auto* const addr = reinterpret_cast<std::byte*>(self->heap_) + old_size;
+    return ::mmap(addr, new_size - old_size, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_FIXED, self->fd_,
+                  off_t(old_size)) != MAP_FAILED;
+  }
+
+  void pCreate(const std::string& path, const std::size_t reserved_size) {
+    const auto page_size = prhdtls::os_page_size();
+    const auto reserved =
+        (std::max(reserved_size, page_size * 2) + page_size - 1) / page_size *
+        page_size;
+    const auto initial_size = std::min(reserved, page_size * 16);
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ == -1 || ::ftruncate(fd_, off_t(initial_size)) != 0) {
+      pClose();
+      return;
+    }
+    void* const base = pReserve(nullptr, reserved);
+    if (!base || !pMapFile(base, initial_size)) {
+      pClose();
+      return;
+    }
+    heap_ = new (base) prhdtls::MmapHeap();
+    heap_->Init(reserved, initial_size);
+    heap_->Attach(&mmap_segment::pGrow, this);
+  }
+
+  void pOpen(const std::string& path) {
+    fd_ = ::open(path.c_str(), O_RDWR);
+    if (fd_ == -1) return;
+
+    prhdtls::MmapHeap header;
+    if (prhdtls::os_read(fd_, &header, sizeof(header)) !=
+            ssize_t(sizeof(header)) ||
+        header.magic != prhdtls::MmapHeap::kMagic ||
+        header.version != prhdtls::MmapHeap::kVersion) {
+      pClose();
+      return;
+    }
+    void* const base =
+        pReserve(reinterpret_cast<void*>(header.base_address),
+                 header.reserved_size);
+    if (base != reinterpret_cast<void*>(header.base_address) ||
+        !pMapFile(base, header.mapped_size)) {
+      pClose();
+      return;
+    }
+    heap_ = static_cast<prhdtls::MmapHeap*>(base);
+    if (!heap_->Valid()) {
+      heap_ = nullptr;
+      pClose();
+      return;
+    }
+    heap_->Attach(&mmap_segment::pGrow, this);
+  }
+
+  /// Reserve a virtual address range without committing memory.
+  void* pReserve(void* const hint, const std::size_t size) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#ifdef MAP_FIXED_NOREPLACE
+    if (hint) flags |= MAP_FIXED_NOREPLACE;
+#endif
+    void* const addr = ::mmap(hint, size, PROT_NONE, flags, -1, 0);
+    if (addr == MAP_FAILED) return nullptr;
+    reserved_addr_ = addr;
+    reserved_size_ = size;
+    return addr;
+  }
+
+  bool pMapFile(void* const base, const std::size_t size) {
+    return ::mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                  fd_, 0) != MAP_FAILED;
+  }
+
+  void pClose() noexcept {
+    if (heap_) {
+      flush();
+      heap_->Attach(nullptr, nullptr);
+      heap_ = nullptr;
+    }
+    if (reserved_addr_) {
+      ::munmap(reserved_addr_, reserved_size_);
+      reserved_addr_ = nullptr;
+    }
+    if (fd_ != -1) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  int fd_{-1};
+  void* reserved_addr_{nullptr};
+  std::size_t reserved_size_{0};
+  prhdtls::MmapHeap* heap_{nullptr};
+};
+
+inline constexpr mmap_segment::create_only_t create_only{};
+inline constexpr mmap_segment::open_only_t open_only{};
+
+/// \brief An allocator that allocates memory from an mmap_segment.
+/// The allocator refers to the heap inside the segment; thus, an allocator
+/// stored in the segment (e.g., in a container) stays valid after the
+/// segment is reopened.
+template <typename T>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = mmap_allocator<U>;
+  };
+
+  explicit mmap_allocator(const mmap_segment& segment) noexcept
+      : heap_(segment.heap()) {}
+
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U>& other) noexcept
+      : heap_(other.heap()) {}
+
+  pointer allocate(const size_type n) {
+    if (!heap_) return nullptr;
+    return static_cast<pointer>(heap_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(pointer p, const size_type n) noexcept {
+    if (heap_) heap_->Deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  /// \brief Try to grow the allocation at p from old_n to new_n elements
+  /// without moving it.
+  /// \return True if the allocation was grown in place.
+  bool expand_in_place(pointer p, const size_type old_n,
+                       const size_type new_n) noexcept {
+    return heap_ &&
+           heap_->ExpandInPlace(p, old_n * sizeof(T), new_n * sizeof(T));
+  }
+
+  /// \brief Try to shrink the allocation at p from old_n to new_n elements
+  /// without moving it, releasing the tail.
+  /// \return True if the allocation was shrunk in place.
+  bool shrink_in_place(pointer p, const size_type old_n,
+                       const size_type new_n) noexcept {
+    return heap_ &&
+           heap_->ShrinkInPlace(p, old_n * sizeof(T), new_n * sizeof(T));
+  }
+
+  /// \brief Give the pages that are entirely in [addr, addr + length) back
+  /// to the file system. The range must be inside a block allocated by this
+  /// allocator; its contents are lost.
+  bool discard_pages(void* const addr, const size_type length) noexcept {
+    return heap_ && prhdtls::os_discard_pages(addr, length, MADV_REMOVE);
+  }
+
+  prhdtls::MmapHeap* heap() const noexcept { return heap_; }
+
+ private:
+  prhdtls::MmapHeap* heap_{nullptr};
+};
+
+template <typename T, typename U>
+bool operator==(const mmap_allocator<T>& lhs,
+                const mmap_allocator<U>& rhs) noexcept {
+  return lhs.heap() == rhs.heap();
+}
+
+template <typename T, typename U>
+bool operator!=(const mmap_allocator<T>& lhs,
+                const mmap_allocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht
@@ -5,8 +5,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
 
 #include "details/perroht_impl.hpp"
@@ -21,14 +25,18 @@ namespace perroht {
 /// \tparam KeyEqualOp The key equality operator to be used.
 /// \tparam embed If true, works as a flat map. Otherwise, works as a node map.
 /// \tparam Alloc The allocator to be used.
+/// \tparam Layout The layout of the table in memory, e.g., InterleavedLayout
+/// or SeparateHeaderLayout (see details/layout.hpp).
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
           typename KeyEqualOp = std::equal_to<Key>, bool embed = true,
           typename Alloc = std::allocator<typename prhdtls::KeyValueTraits<
-              Key, Value, embed>::KeyValueType>>
+              Key, Value, embed>::KeyValueType>,
+          typename Layout = DefaultLayout>
 class Perroht {
  private:
-  using SelfType = Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>;
-  using Impl = prhdtls::PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc>;
+  using SelfType = Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>;
+  using Impl = prhdtls::PerrohtImpl<Key, Value, Hash, KeyEqualOp, embed, Alloc,
+                                    Layout>;
 
  public:
   using KeyType = typename Impl::KeyType;
@@ -37,10 +45,18 @@ class Perroht {
   using Hasher = typename Impl::Hasher;
   using KeyEqual = typename Impl::KeyEqual;
   using Allocator = typename Impl::Allocator;
+  /// For uses-allocator construction, e.g., by std::scoped_allocator_adaptor.
+  using allocator_type = Allocator;
   using SizeType = typename Impl::SizeType;
   using DifferentType = typename Impl::DifferentType;
   using Iterator = typename Impl::Iterator;
   using ConstIterator = typename Impl::ConstIterator;
+  using View = typename Impl::View;
+  using ConstView = typename Impl::ConstView;
+  using BatchOperation = typename Impl::BatchOperationType;
+  using Snapshot = typename Impl::SnapshotView;
+  using ChangeLog = typename Impl::ChangeLogType;
+  using WarmUpTask = typename Impl::WarmUpTaskType;
 
   /// \brief Return the maximum probe distance this container accepts.
   /// This container grows automatically when the probe distance exceeds this
@@ -93,6 +109,22 @@ class Perroht {
   Perroht(Perroht&& other, const Allocator& alloc)
       : impl_(std::move(other.impl_), alloc) {}
 
+  /// \brief Converting move constructor from a container that uses another
+  /// allocator type.
+  /// Allows building a table in DRAM (e.g., with std::allocator) and then
+  /// moving it into a persistent allocator in one shot. The table image is
+  /// copied in bulk if the elements are embedded and trivially copyable;
+  /// otherwise, elements are moved one by one. The memory of the source table
+  /// is given back to the OS in chunks as it is migrated, which bounds the
+  /// peak memory usage. The elements keep their positions.
+  /// \param other The other Perroht to move from.
+  /// \param alloc The allocator object.
+  template <typename OtherAlloc>
+  Perroht(
+      Perroht<Key, Value, Hash, KeyEqualOp, embed, OtherAlloc, Layout>&& other,
+      const Allocator& alloc)
+      : impl_(std::move(other.impl_), alloc) {}
+
   /// \brief Copy Assignment Operator.
   Perroht& operator=(const Perroht& other) = default;
 
@@ -108,20 +140,22 @@ class Perroht {
   /// \param lhd The left hand side Perroht to compare with.
   /// \return True if the two containers have the size sizes and equal key-value
   /// elements. This operator does not check the order of the elements.
-  template <typename K, typename V, typename H, typename E, bool e, typename A>
+  template <typename K, typename V, typename H, typename E, bool e, typename A,
+            typename L>
   friend constexpr bool operator==(
-      const Perroht<K, V, H, E, e, A>& rhd,
-      const Perroht<K, V, H, E, e, A>& lhd) noexcept;
+      const Perroht<K, V, H, E, e, A, L>& rhd,
+      const Perroht<K, V, H, E, e, A, L>& lhd) noexcept;
 
   /// \brief Not equal operator.
   /// \param rhd The right hand side Perroht to compare with.
   /// \param lhd The left hand side Perroht to compare with.
   /// \return True if the two Perroht are not equal (== operator
   /// returns false), false otherwise.
-  template <typename K, typename V, typename H, typename E, bool e, typename A>
+  template <typename K, typename V, typename H, typename E, bool e, typename A,
+            typename L>
   friend constexpr bool operator!=(
-      const Perroht<K, V, H, E, e, A>& rhd,
-      const Perroht<K, V, H, E, e, A>& lhd) noexcept;
+      const Perroht<K, V, H, E, e, A, L>& rhd,
+      const Perroht<K, V, H, E, e, A, L>& lhd) noexcept;
 
   /// \brief Get the allocator.
   /// \return The allocator.
@@ -283,6 +317,17 @@ class Perroht {
   /// if there is such an element, otherwise false.
   inline bool Contains(const KeyType& key) const { return impl_.Contains(key); }
 
+  /// \brief Return a view that resolves the table address and capacity once
+  /// and provides Find(), Contains(), Count(), Insert(), and Erase() on raw
+  /// pointers. Use it for a batch of operations when the allocator uses
+  /// fancy pointers, e.g., offset pointers.
+  /// The view must be refreshed (View::Refresh()) or obtained again after
+  /// the container is modified through anything but the view.
+  inline View GetView() { return impl_.GetView(); }
+
+  /// \brief Return a read-only view. See GetView().
+  inline ConstView GetView() const { return impl_.GetView(); }
+
   // ----- Hash policy ----- //
 
   /// \brief Get the load factor.
@@ -306,6 +351,29 @@ class Perroht {
     impl_.MaxLoadFactor(max_load_factor);
   }
 
+  /// \brief Get the bound on the probe distances set by
+  /// StashProbeBound(SizeType). The elements already in the table may be
+  /// placed farther. The maximum value of SizeType, the default, means that
+  /// the probe distances are not bounded.
+  inline SizeType StashProbeBound() const {
+    return impl_.StashProbeBound();
+  }
+
+  /// \brief Bound the probe distances of the elements inserted from now on.
+  /// Elements that would be placed farther from their ideal positions are
+  /// kept in a small overflow stash, which is searched only when it is not
+  /// empty. While the stash has room, the table grows only by the load
+  /// factor. Nothing is stashed while the dirty pages are tracked, a snapshot
+  /// exists, or a batch is applied (see ApplyBatch()).
+  /// \param stash_probe_bound The maximum probe distance. The maximum value
+  /// of SizeType, the default, disables the bound.
+  inline void StashProbeBound(const SizeType stash_probe_bound) {
+    impl_.StashProbeBound(stash_probe_bound);
+  }
+
+  /// \brief Get the number of elements in the overflow stash.
+  inline SizeType StashSize() const { return impl_.StashSize(); }
+
   /// \brief Sets the capacity of the table at least to capacity and rehash the
   /// table. This will rehash the all items in the table.
   /// \return True if the operation was successful, false otherwise.
@@ -324,6 +392,24 @@ class Perroht {
   /// equal to or smaller than the current capacity, false otherwise.
   inline bool Reserve(SizeType capacity) { return impl_.Reserve(capacity); }
 
+  /// \brief Enable or disable in-place resizing.
+  /// When enabled, Reserve(), Rehash(), and ShrinkToFit() extend or shrink
+  /// the current allocation of the table and move the elements within it,
+  /// instead of building a new table next to the current one.
+  /// This requires an allocator that provides expand_in_place() and, for
+  /// shrinking, shrink_in_place() (e.g., perroht::mmap_allocator).
+  /// An in-place resize is not crash-consistent.
+  /// \param enable True to enable in-place resizing.
+  /// \return False if the allocator does not support it.
+  inline bool ResizeInPlace(const bool enable) {
+    return impl_.ResizeInPlace(enable);
+  }
+
+  /// \brief Return true if in-place resizing is enabled.
+  inline bool ResizingInPlace() const noexcept {
+    return impl_.ResizingInPlace();
+  }
+
   /// \brief Get the min, mean, and max probe distances.
   /// This function Takes O(n) time, where n is the number of elements in the
   /// table.
@@ -365,31 +451,224 @@ class Perroht {
   /// \return The key equal operator.
   inline KeyEqual GetKeyEqual() const { return impl_.GetKeyEqual(); }
 
+  // ----- Consistency ----- //
+
+  /// \brief Return true if resizing this container is crash-consistent,
+  /// i.e., a resize interrupted by an abnormal termination can be handled by
+  /// Recover(). This is the case for node containers and flat containers whose
+  /// elements are trivially copyable (or pairs of such types).
+  static constexpr bool CrashConsistentResize() {
+    return Impl::CrashConsistentResize();
+  }
+
+  /// \brief Return true if a batch applied by ApplyBatch() is restored and
+  /// applied again by Recover() when it was interrupted by an abnormal
+  /// termination. This is the case for flat containers whose elements are
+  /// trivially copyable (or pairs of such types).
+  static constexpr bool CrashConsistentBatch() {
+    return Impl::CrashConsistentBatch();
+  }
+
+  /// \brief Finish or roll back a resize that was interrupted by an abnormal
+  /// termination of the process, and replay the batch committed by
+  /// ApplyBatch() if it had not been applied completely. Call this function
+  /// after reopening a container allocated in a persistent memory segment
+  /// (e.g., Metall) before any other operation. Does nothing if no resize or
+  /// batch was in progress.
+  /// \return True if the container is consistent, false if the interrupted
+  /// resize or batch could not be recovered (see CrashConsistentResize() and
+  /// CrashConsistentBatch()).
+  inline bool Recover() { return impl_.Recover(); }
+
+  /// \brief Check the invariants of the table using multiple threads.
+  /// This function takes O(n / num_threads) time, where n is the capacity of
+  /// the table, and is much faster than rebuilding the table.
+  /// \param num_threads The number of threads to use.
+  /// \return True if the table is consistent, false otherwise.
+  inline bool CheckIntegrity(const SizeType num_threads =
+                                 std::thread::hardware_concurrency()) const {
+    return impl_.CheckIntegrity(num_threads);
+  }
+
+  // ----- Durability ----- //
+
+  /// \brief Apply insertions and erasures as a single atomic batch.
+  /// The operations are appended to a redo log allocated by the container's
+  /// allocator, and the log is flushed once before the operations are applied
+  /// to the table. The log also receives the undo image of each table page
+  /// before the page is modified for the first time in the batch. If the
+  /// process dies before the batch is applied and flushed, Recover() restores
+  /// the table from the undo images and applies the batch again on reopen.
+  /// Only the pages modified by the batch are flushed.
+  /// Operations are applied in order. An insertion does nothing if the key
+  /// already exists, as Insert() does.
+  /// Undo images are taken only if CrashConsistentBatch() is true; for other
+  /// containers, the modified pages are flushed at the end of the batch, but
+  /// Recover() fails if the batch was interrupted while it was applied.
+  /// \param ops A range of BatchOperation.
+  /// \return True on success. False if the batch could not be logged (the
+  /// container is unchanged) or the table could not be flushed (the batch
+  /// remains in the log and is replayed by Recover()).
+  template <typename Operations>
+  inline bool ApplyBatch(const Operations& ops) {
+    return impl_.ApplyBatch(ops);
+  }
+
+  /// \brief Return the number of operations in the redo log that have not
+  /// been applied and flushed yet.
+  inline SizeType NumPendingBatchOperations() const {
+    return impl_.NumPendingBatchOperations();
+  }
+
+  /// \brief Start or stop recording the pages modified by this container so
+  /// that Sync() can flush only them, instead of the whole mapping.
+  /// All pages are considered clean when the recording starts.
+  /// \return False if the recording data could not be allocated.
+  inline bool TrackDirtyPages(const bool enable) {
+    return impl_.TrackDirtyPages(enable);
+  }
+
+  /// \brief Return true if the modified pages are being recorded.
+  inline bool TrackingDirtyPages() const noexcept {
+    return impl_.TrackingDirtyPages();
+  }
+
+  /// \brief Record that the value pointed by the iterator is modified.
+  /// Insertions and erasures are recorded automatically; call this function
+  /// before updating a value through an iterator or a reference.
+  inline void MarkDirty(const Iterator& it) { impl_.MarkDirty(it); }
+
+  /// \copydoc MarkDirty(const Iterator&)
+  inline void MarkDirty(const ConstIterator& it) { impl_.MarkDirty(it); }
+
+  /// \brief Return the number of the table pages modified since the last
+  /// sync.
+  inline SizeType NumDirtyPages() const { return impl_.NumDirtyPages(); }
+
+  /// \brief Flush the pages modified since the last sync with msync(2).
+  /// \return True on success, false otherwise.
+  inline bool Sync() { return impl_.Sync(); }
+
+  /// \brief Asynchronous version of Sync().
+  /// The flush runs on a background thread. The container can be modified
+  /// while the flush is in progress, but must not be resized until the
+  /// returned future is ready.
+  inline std::future<bool> SyncAsync() { return impl_.SyncAsync(); }
+
+  /// \brief Return the page-aligned ranges Sync() would flush and mark the
+  /// modified pages clean, for callers that flush them on their own.
+  /// The ranges include the pages of this container object.
+  inline std::vector<prhdtls::MemoryRange> TakeSyncRanges() {
+    return impl_.TakeSyncRanges();
+  }
+
+  // ----- Snapshot ----- //
+
+  /// \brief Take a copy-on-write snapshot of the container.
+  /// The returned snapshot provides a stable, read-only view of the
+  /// container that can be scanned by another thread while this container is
+  /// modified. The container copies a table page before modifying it for the
+  /// first time after the snapshot was taken; thus, the cost is proportional
+  /// to the number of modified pages, not to the container size.
+  /// Values updated through iterators must be announced by MarkDirty()
+  /// before the update.
+  /// Only available for flat containers whose elements are trivially copyable
+  /// (or pairs of such types).
+  /// Snapshots are not persisted.
+  /// \return A snapshot. Snapshot::Valid() is false if the previous
+  /// snapshot has not been released yet.
+  inline Snapshot TakeSnapshot() { return impl_.TakeSnapshot(); }
+
+  // ----- Warm-up ----- //
+
+  /// \brief Prefault the container on background threads, e.g., after
+  /// reopening a persistent segment.
+  /// Lookups can be served while the warm-up is in progress; they are just
+  /// slower until the pages they touch have been faulted in. If headers are
+  /// stored separately (e.g., SeparateHeaderLayout), they are prefaulted
+  /// first.
+  /// The container must not be modified or destroyed until the returned task
+  /// is done (WarmUpTask::Done()) or destroyed; destroying the task cancels
+  /// the remaining work.
+  /// \param num_threads The number of threads to use.
+  /// \return A task that reports the progress (WarmUpTask::Progress()).
+  inline std::unique_ptr<WarmUpTask> WarmUp(
+      const SizeType num_threads = std::thread::hardware_concurrency()) const {
+    return impl_.WarmUp(num_threads);
+  }
+
+  // ----- Change Data Capture ----- //
+
+  /// \brief Record the following insertions, updates, and erasures in the
+  /// given change log, e.g., to replicate this container incrementally with
+  /// ApplyChanges(). Pass nullptr to stop recording.
+  /// The log is not owned by the container and must outlive the attachment.
+  /// Only available if the keys and values are trivially copyable.
+  /// Updates are recorded only if made by UpdateValue().
+  inline void AttachChangeLog(ChangeLog* const change_log) {
+    impl_.AttachChangeLog(change_log);
+  }
+
+  /// \brief Return the attached change log, or nullptr.
+  inline ChangeLog* GetChangeLog() const noexcept {
+    return impl_.GetChangeLog();
+  }
+
+  /// \brief Update the value of the element pointed by the iterator.
+  /// The update is recorded by the dirty page tracking, the snapshot, and the
+  /// change log.
+  template <typename V>
+  inline void UpdateValue(const Iterator& it, V&& value) {
+    impl_.UpdateValue(it, std::forward<V>(value));
+  }
+
+  /// \brief Apply the changes recorded in the change log in the given
+  /// directory after the given sequence number.
+  /// \param log_dir The directory of the change log.
+  /// \param after_sequence The sequence number of the last change applied
+  /// previously; 0 to apply all changes.
+  /// \param last_sequence If not null, the sequence number of the last change
+  /// applied is stored. Pass it to the next call.
+  /// \return False if some of the requested changes are no longer in the log,
+  /// i.e., a full copy is needed to catch up.
+  inline bool ApplyChanges(const std::string& log_dir,
+                           const uint64_t after_sequence,
+                           uint64_t* const last_sequence = nullptr) {
+    return impl_.ApplyChanges(log_dir, after_sequence, last_sequence);
+  }
+
  private:
+  template <typename K, typename V, typename H, typename E, bool e,
+            typename A, typename L>
+  friend class Perroht;
+
   Impl impl_;
 };
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr bool operator==(
-    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& rhd,
-    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd) noexcept {
+    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>& rhd,
+    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        lhd) noexcept {
   return rhd.impl_ == lhd.impl_;
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr bool operator!=(
-    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& rhd,
-    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd) noexcept {
+    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>& rhd,
+    const Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        lhd) noexcept {
   return rhd.impl_ != lhd.impl_;
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqualOp,
-          bool embed, typename Alloc>
+          bool embed, typename Alloc, typename Layout>
 constexpr void swap(
-    Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& rhd,
-    Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc>& lhd) noexcept {
+    Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>& rhd,
+    Perroht<Key, Value, Hash, KeyEqualOp, embed, Alloc, Layout>&
+        lhd) noexcept {
   rhd.Swap(lhd);
 }
 
@@ -0,0 +1,545 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "perroht/perroht.hpp"
+
+namespace perroht {
+
+/// \brief A map that stores up to N elements inline, in the object itself,
+/// and moves them to a Perroht table once it holds more.
+/// While the elements are inline, a lookup is a linear scan that compares
+/// keys only: no hash value is computed and no table is allocated. This suits
+/// a large number of small maps, e.g., per-vertex adjacency maps.
+/// Once the elements have moved to a table, they stay there until clear().
+/// Erasing an inline element moves the last inline element into its place.
+/// \warning Insertions may invalidate iterators; moving the elements to a
+/// table also invalidates references. Erasing an inline element invalidates
+/// the iterators and references to the last element.
+/// \tparam N The number of elements stored inline.
+template <typename Key, typename T, std::size_t N = 8,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class small_flat_map {
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using Table =
+      Perroht<Key, T, Hash, KeyEqual, true,
+              typename AllocTraits::template rebind_alloc<std::pair<Key, T>>>;
+  using TableAllocator = typename AllocTraits::template rebind_alloc<Table>;
+  using TableAllocTraits = std::allocator_traits<TableAllocator>;
+  using TablePointer = typename TableAllocTraits::pointer;
+
+  static_assert(N > 0, "At least one element must be stored inline");
+
+  template <bool IsConst>
+  class BaseIterator {
+   private:
+    using TableIterator =
+        std::conditional_t<IsConst, typename Table::ConstIterator,
+                           typename Table::Iterator>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Table::KeyValueType;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<IsConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+    BaseIterator() = default;
+
+    /// Conversion from an iterator to a const iterator.
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    BaseIterator(const BaseIterator<false>& other)
+        : inline_pos_(other.inline_pos_), table_it_(other.table_it_) {}
+
+    reference operator*() const {
+      return inline_pos_ ? *inline_pos_ : *table_it_;
+    }
+
+    pointer operator->() const { return &**this; }
+
+    BaseIterator& operator++() {
+      if (inline_pos_) {
+        ++inline_pos_;
+      } else {
+        ++table_it_;
+      }
+      return *this;
+    }
+
+    BaseIterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const BaseIterator& other) const {
+      return inline_pos_ == other.inline_pos_ &&
+             (inline_pos_ || table_it_ == other.table_it_);
+    }
+
+    bool operator!=(const BaseIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class small_flat_map;
+
+    template <bool>
+    friend class BaseIterator;
+
+    explicit BaseIterator(const pointer inline_pos) : inline_pos_(inline_pos) {}
+
+    explicit BaseIterator(const TableIterator& it) : table_it_(it) {}
+
+    // Null if the elements are in a table.
+    pointer inline_pos_{nullptr};
+    TableIterator table_it_{};
+  };
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = typename Table::KeyValueType;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = BaseIterator<false>;
+  using const_iterator = BaseIterator<true>;
+
+  small_flat_map() : small_flat_map(0) {}
+
+  explicit small_flat_map(size_type n, const Hash& hash = Hash(),
+                          const key_equal& equal = key_equal(),
+                          const allocator_type& alloc = allocator_type())
+      : allocator_(alloc), hasher_(hash), key_equal_(equal) {
+    reserve(n);
+  }
+
+  explicit small_flat_map(const allocator_type& alloc)
+      : small_flat_map(0, Hash(), key_equal(), alloc) {}
+
+  small_flat_map(const small_flat_map& other)
+      : small_flat_map(other,
+                       AllocTraits::select_on_container_copy_construction(
+                           other.allocator_)) {}
+
+  small_flat_map(small_flat_map&& other) noexcept
+      : allocator_(std::move(other.allocator_)),
+        hasher_(std::move(other.hasher_)),
+        key_equal_(std::move(other.key_equal_)) {
+    pMoveElementsFrom(other);
+  }
+
+  small_flat_map(const small_flat_map& other, const allocator_type& alloc)
+      : allocator_(alloc),
+        hasher_(other.hasher_),
+        key_equal_(other.key_equal_) {
+    if (other.pInTable()) {
+      pNewTable(*other.table_, typename Table::Allocator(allocator_));
+      return;
+    }
+    for (const auto& element : other) {
+      pConstructInline(element);
+    }
+  }
+
+  small_flat_map(small_flat_map&& other, const allocator_type& alloc)
+      : allocator_(alloc),
+        hasher_(std::move(other.hasher_)),
+        key_equal_(std::move(other.key_equal_)) {
+    if (other.pInTable()) {
+      pNewTable(std::move(*other.table_),
+                typename Table::Allocator(allocator_));
+      other.pReset();
+      return;
+    }
+    pMoveElementsFrom(other);
+  }
+
+  ~small_flat_map() noexcept { pReset(); }
+
+  small_flat_map& operator=(const small_flat_map& other) {
+    if (this != &other) {
+      small_flat_map tmp(other);
+      *this = std::move(tmp);
+    }
+    return *this;
+  }
+
+  small_flat_map& operator=(small_flat_map&& other) noexcept {
+    if (this != &other) {
+      pReset();
+      allocator_ = std::move(other.allocator_);
+      hasher_ = std::move(other.hasher_);
+      key_equal_ = std::move(other.key_equal_);
+      pMoveElementsFrom(other);
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+  // ----- Iterators ----- //
+
+  iterator begin() noexcept {
+    return pInTable() ? iterator(table_->Begin()) : iterator(pInline());
+  }
+
+  const_iterator begin() const noexcept {
+    return pInTable() ? const_iterator(pTable().Begin())
+                      : const_iterator(pInline());
+  }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  iterator end() noexcept {
+    return pInTable() ? iterator(table_->End())
+                      : iterator(pInline() + num_inline_);
+  }
+
+  const_iterator end() const noexcept {
+    return pInTable() ? const_iterator(pTable().End())
+                      : const_iterator(pInline() + num_inline_);
+  }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return pInTable() ? pTable().Size() : num_inline_;
+  }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() - 1;
+  }
+
+  /// \brief Return the number of elements stored inline before they are
+  /// moved to a table.
+  static constexpr size_type inline_capacity() noexcept { return N; }
+
+  // ----- Modifiers ----- //
+
+  /// \brief Erase all elements and free the table, if any.
+  /// Elements are stored inline again afterward.
+  void clear() noexcept { pReset(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    value_type value(std::forward<Args>(args)...);
+    return insert(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return pTryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return pTryEmplace(std::move(key), std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key& key) {
+    if (pInTable()) {
+      return table_->Erase(key);
+    }
+    const auto i = pFindInline(key);
+    if (i == num_inline_) {
+      return 0;
+    }
+    pEraseInline(i);
+    return 1;
+  }
+
+  /// \brief Erase the element at the given position.
+  /// \return An iterator to the element that follows the erased one. If the
+  /// elements are inline, it is at the same position, which holds the element
+  /// that was the last one.
+  iterator erase(const_iterator pos) {
+    if (pInTable()) {
+      return iterator(table_->Erase(pos.table_it_));
+    }
+    const auto i = size_type(pos.inline_pos_ - pInline());
+    pEraseInline(i);
+    return iterator(pInline() + i);
+  }
+
+  void swap(small_flat_map& other) noexcept {
+    small_flat_map tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  // ----- Lookup ----- //
+
+  T& at(const Key& key) {
+    return const_cast<T&>(const_cast<const small_flat_map*>(this)->at(key));
+  }
+
+  const T& at(const Key& key) const {
+    const auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  iterator find(const Key& key) {
+    if (pInTable()) {
+      return iterator(table_->Find(key));
+    }
+    return iterator(pInline() + pFindInline(key));
+  }
+
+  const_iterator find(const Key& key) const {
+    if (pInTable()) {
+      return const_iterator(pTable().Find(key));
+    }
+    return const_iterator(pInline() + pFindInline(key));
+  }
+
+  bool contains(const Key& key) const {
+    if (pInTable()) {
+      return pTable().Contains(key);
+    }
+    return pFindInline(key) < num_inline_;
+  }
+
+  // ----- Hash Policy ----- //
+
+  /// \brief Reserve space for at least count elements.
+  /// The elements are moved to a table if count is larger than N.
+  void reserve(size_type count) {
+    if (pInTable()) {
+      table_->Reserve(count);
+    } else if (count > N) {
+      pMoveToTable(count);
+    }
+  }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return hasher_; }
+
+  key_equal key_eq() const { return key_equal_; }
+
+ private:
+  static constexpr size_type kInTable = std::numeric_limits<size_type>::max();
+
+  bool pInTable() const noexcept { return num_inline_ == kInTable; }
+
+  const Table& pTable() const noexcept { return *table_; }
+
+  value_type* pInline() noexcept {
+    return std::launder(reinterpret_cast<value_type*>(inline_));
+  }
+
+  const value_type* pInline() const noexcept {
+    return std::launder(reinterpret_cast<const value_type*>(inline_));
+  }
+
+  /// Return the index of the inline element with the given key, or
+  /// num_inline_ if there is none.
+  size_type pFindInline(const Key& key) const {
+    const auto* const elements = pInline();
+    for (size_type i = 0; i < num_inline_; ++i) {
+      if (key_equal_(elements[i].first, key)) {
+        return i;
+      }
+    }
+    return num_inline_;
+  }
+
+  template <typename... Args>
+  value_type* pConstructInline(Args&&... args) {
+    assert(num_inline_ < N);
+    auto* const element = pInline() + num_inline_;
+    AllocTraits::construct(allocator_, element, std::forward<Args>(args)...);
+    ++num_inline_;
+    return element;
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> pTryEmplace(K&& key, Args&&... args) {
+    if (!pInTable()) {
+      const auto i = pFindInline(key);
+      if (i < num_inline_) {
+        return {iterator(pInline() + i), false};
+      }
+      if (num_inline_ < N) {
+        auto* const element = pConstructInline(
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(element), true};
+      }
+      pMoveToTable(N + 1);
+    }
+    const auto [it, inserted] = table_->TryEmplace(
+        std::forward<K>(key), std::forward<Args>(args)...);
+    return {iterator(it), inserted};
+  }
+
+  /// Erase the inline element at the given index, moving the last inline
+  /// element into its place.
+  void pEraseInline(const size_type i) {
+    auto* const elements = pInline();
+    const auto last = num_inline_ - 1;
+    if (i != last) {
+      elements[i] = std::move(elements[last]);
+    }
+    AllocTraits::destroy(allocator_, elements + last);
+    --num_inline_;
+  }
+
+  /// Allocate a table constructed with the given arguments.
+  /// The inline elements must have been destroyed or moved already.
+  template <typename... Args>
+  void pNewTable(Args&&... args) {
+    TableAllocator alloc(allocator_);
+    TablePointer table = TableAllocTraits::allocate(alloc, 1);
+    if (!table) {
+      assert(false);
+      std::abort();
+    }
+    TableAllocTraits::construct(alloc, prhdtls::ToAddress(table),
+                                std::forward<Args>(args)...);
+    new (&table_) TablePointer(table);
+    num_inline_ = kInTable;
+  }
+
+  /// Move the inline elements to a new table with space for at least
+  /// capacity elements.
+  void pMoveToTable(const size_type capacity) {
+    Table table(capacity, 0.875, hasher_, key_equal_,
+                typename Table::Allocator(allocator_));
+    auto* const elements = pInline();
+    for (size_type i = 0; i < num_inline_; ++i) {
+      table.Insert(std::move(elements[i]));
+      AllocTraits::destroy(allocator_, elements + i);
+    }
+    num_inline_ = 0;
+    pNewTable(std::move(table));
+  }
+
+  /// Take over the elements of other, which becomes empty.
+  /// This container must be empty and store its elements inline.
+  void pMoveElementsFrom(small_flat_map& other) noexcept {
+    assert(!pInTable() && num_inline_ == 0);
+    if (other.pInTable()) {
+      new (&table_) TablePointer(std::move(other.table_));
+      num_inline_ = kInTable;
+      other.table_.~TablePointer();
+      other.num_inline_ = 0;
+      return;
+    }
+    for (auto& element : other) {
+      pConstructInline(std::move(element));
+    }
+    other.pReset();
+  }
+
+  /// Destroy all elements and free the table, if any.
+  void pReset() noexcept {
+    if (pInTable()) {
+      TableAllocator alloc(allocator_);
+      TableAllocTraits::destroy(alloc, prhdtls::ToAddress(table_));
+      TableAllocTraits::deallocate(alloc, table_, 1);
+      table_.~TablePointer();
+    } else {
+      auto* const elements = pInline();
+      for (size_type i = 0; i < num_inline_; ++i) {
+        AllocTraits::destroy(allocator_, elements + i);
+      }
+    }
+    num_inline_ = 0;
+  }
+
+  Allocator allocator_;
+  Hash hasher_;
+  KeyEqual key_equal_;
+  // The number of inline elements, or kInTable if the elements are in the
+  // table.
+  size_type num_inline_{0};
+  union {
+    TablePointer table_;
+    alignas(value_type) std::byte inline_[N * sizeof(value_type)];
+  };
+};
+
+template <typename Key, typename T, std::size_t N, typename Hash,
+          typename KeyEqual, typename Allocator>
+void swap(small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+          small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash,
+          typename KeyEqual, typename Allocator>
+bool operator==(
+    const small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+    const small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (const auto& [key, value] : lhs) {
+    const auto it = rhs.find(key);
+    if (it == rhs.end() || !(it->second == value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash,
+          typename KeyEqual, typename Allocator>
+bool operator!=(
+    const small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& lhs,
+    const small_flat_map<Key, T, N, Hash, KeyEqual, Allocator>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace perroht
@@ -0,0 +1,198 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "details/string_flat_table.hpp"
+
+namespace perroht {
+
+/// \brief A flat map for string keys that stores short strings in the table.
+/// Strings of up to inline_capacity bytes are stored in the table positions
+/// with their lengths; longer strings are stored in an append-only arena
+/// owned by the map and referred to by offsets. Thus, short keys cost no
+/// allocation, and a lookup compares the hash values, lengths, and prefixes
+/// before reading a string from the arena. Follows the same Robin Hood
+/// hashing scheme as Perroht and can be stored in persistent memory with a
+/// persistent allocator.
+/// Keys are passed and returned as std::string_view; dereferencing an
+/// iterator returns a pair of a view of the key and a reference to the value.
+/// \warning Values must be default constructible. Views of keys are
+/// invalidated by an insertion, like iterators.
+template <typename T, typename Hash = std::hash<std::string_view>,
+          typename Allocator = std::allocator<std::pair<std::string, T>>>
+class string_flat_map {
+ private:
+  using ImplType = prhdtls::StringFlatTable<T, Hash, Allocator>;
+
+ public:
+  using key_type = std::string_view;
+  using mapped_type = T;
+  using value_type = std::pair<std::string_view, T>;
+  using size_type = typename ImplType::SizeType;
+  using difference_type = typename ImplType::DifferentType;
+  using hasher = Hash;
+  using key_equal = std::equal_to<std::string_view>;
+  using allocator_type = Allocator;
+  using iterator = typename ImplType::Iterator;
+  using const_iterator = typename ImplType::ConstIterator;
+
+  /// The length of the longest key that is stored in the table.
+  static constexpr size_type inline_capacity =
+      prhdtls::StringKey::kInlineCapacity;
+
+  string_flat_map() : impl_() {}
+
+  explicit string_flat_map(size_type n, const Hash& hash = Hash(),
+                           const allocator_type& alloc = allocator_type())
+      : impl_(n, 0.875, hash, alloc) {}
+
+  explicit string_flat_map(const allocator_type& alloc)
+      : impl_(0, 0.875, Hash(), alloc) {}
+
+  string_flat_map(const string_flat_map& other) = default;
+  string_flat_map(string_flat_map&& other) noexcept = default;
+
+  string_flat_map(const string_flat_map& other, const allocator_type& alloc)
+      : impl_(other.impl_, alloc) {}
+
+  string_flat_map(string_flat_map&& other, const allocator_type& alloc)
+      : impl_(std::move(other.impl_), alloc) {}
+
+  ~string_flat_map() = default;
+
+  string_flat_map& operator=(const string_flat_map& other) = default;
+  string_flat_map& operator=(string_flat_map&& other) noexcept = default;
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(impl_.GetAllocator());
+  }
+
+  // ----- Iterators ----- //
+
+  iterator begin() noexcept { return impl_.Begin(); }
+
+  const_iterator begin() const noexcept { return impl_.Begin(); }
+
+  const_iterator cbegin() const noexcept { return impl_.Begin(); }
+
+  iterator end() noexcept { return impl_.End(); }
+
+  const_iterator end() const noexcept { return impl_.End(); }
+
+  const_iterator cend() const noexcept { return impl_.End(); }
+
+  // ----- Capacity ----- //
+
+  bool empty() const noexcept { return impl_.Empty(); }
+
+  size_type size() const noexcept { return impl_.Size(); }
+
+  size_type max_size() const noexcept { return impl_.MaxSize(); }
+
+  /// \brief Return the number of bytes held by the arena for long keys,
+  /// including the bytes of erased keys that have not been reclaimed.
+  size_type arena_size() const noexcept { return impl_.ArenaSize(); }
+
+  // ----- Modifiers ----- //
+
+  void clear() noexcept { impl_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return impl_.TryEmplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return impl_.TryEmplace(value.first, std::move(value.second));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type key, Args&&... args) {
+    return impl_.TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  size_type erase(const key_type key) { return impl_.Erase(key); }
+
+  iterator erase(const_iterator pos) { return impl_.Erase(pos); }
+
+  void swap(string_flat_map& other) noexcept { impl_.Swap(other.impl_); }
+
+  // ----- Lookup ----- //
+
+  T& at(const key_type key) {
+    return const_cast<T&>(const_cast<const string_flat_map*>(this)->at(key));
+  }
+
+  const T& at(const key_type key) const {
+    const auto it = impl_.Find(key);
+    if (it == impl_.End()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  T& operator[](const key_type key) {
+    return impl_.TryEmplace(key).first->second;
+  }
+
+  size_type count(const key_type key) const { return impl_.Count(key); }
+
+  iterator find(const key_type key) { return impl_.Find(key); }
+
+  const_iterator find(const key_type key) const { return impl_.Find(key); }
+
+  bool contains(const key_type key) const { return impl_.Contains(key); }
+
+  // ----- Bucket Interface ----- //
+
+  size_type bucket_count() const noexcept { return impl_.Capacity(); }
+
+  // ----- Hash Policy ----- //
+
+  float load_factor() const noexcept { return impl_.LoadFactor(); }
+
+  float max_load_factor() const noexcept { return impl_.MaxLoadFactor(); }
+
+  void max_load_factor(const float ml) { impl_.MaxLoadFactor(ml); }
+
+  /// \brief Rebuild the table; the space of erased long keys is reclaimed.
+  void rehash(size_type count) { impl_.Rehash(count); }
+
+  void reserve(size_type count) { impl_.Reserve(count); }
+
+  // ----- Observers ----- //
+
+  hasher hash_function() const { return impl_.GetHashFunction(); }
+
+  key_equal key_eq() const { return key_equal(); }
+
+  friend bool operator==(const string_flat_map& lhs,
+                         const string_flat_map& rhs) {
+    return lhs.impl_ == rhs.impl_;
+  }
+
+  friend bool operator!=(const string_flat_map& lhs,
+                         const string_flat_map& rhs) {
+    return lhs.impl_ != rhs.impl_;
+  }
+
+ private:
+  ImplType impl_;
+};
+
+template <typename T, typename Hash, typename Allocator>
+void swap(string_flat_map<T, Hash, Allocator>& lhs,
+          string_flat_map<T, Hash, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace perroht
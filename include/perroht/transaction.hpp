@@ -0,0 +1,61 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace perroht {
+
+/// \brief Collects insertions and erasures and applies them to a Perroht
+/// container as a single atomic batch (see Perroht::ApplyBatch()).
+/// Nothing is applied to the container until Commit() is called.
+/// Collecting many operations in a transaction amortizes the flush cost.
+/// \tparam Container A Perroht container type.
+template <typename Container>
+class Transaction {
+ public:
+  using KeyType = typename Container::KeyType;
+  using KeyValueType = typename Container::KeyValueType;
+  using SizeType = std::size_t;
+  using Operation = typename Container::BatchOperation;
+
+  explicit Transaction(Container& container) : container_(container) {}
+
+  /// \brief Record an insertion.
+  Transaction& Insert(KeyValueType key_value) {
+    ops_.push_back(Operation::Insert(std::move(key_value)));
+    return *this;
+  }
+
+  /// \brief Record an erasure.
+  Transaction& Erase(KeyType key) {
+    ops_.push_back(Operation::Erase(std::move(key)));
+    return *this;
+  }
+
+  /// \brief Apply the recorded operations to the container atomically.
+  /// The recorded operations are discarded whether it succeeded or not.
+  /// \return The result of Perroht::ApplyBatch().
+  bool Commit() {
+    const bool ret = container_.ApplyBatch(ops_);
+    ops_.clear();
+    return ret;
+  }
+
+  /// \brief Discard the recorded operations.
+  void Abort() { ops_.clear(); }
+
+  /// \brief Return the number of recorded operations.
+  SizeType NumOperations() const { return ops_.size(); }
+
+ private:
+  Container& container_;
+  std::vector<Operation> ops_{};
+};
+
+}  // namespace perroht
@@ -14,13 +14,14 @@
 namespace perroht {
 template <typename Key, typename T, typename Hash = std::hash<Key>,
           typename KeyEqual = std::equal_to<Key>,
-          typename Allocator = std::allocator<std::pair<Key, T>>>
+          typename Allocator = std::allocator<std::pair<Key, T>>,
+          typename Layout = DefaultLayout>
 class unordered_flat_map
     : public prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, true,
-                                          Allocator> {
+                                          Allocator, Layout> {
  private:
-  using Base =
-      prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, true, Allocator>;
+  using Base = prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, true,
+                                            Allocator, Layout>;
 
  public:
   using Base::Base;
@@ -28,13 +29,14 @@ class unordered_flat_map
 
 template <typename Key, typename T, typename Hash = std::hash<Key>,
           typename KeyEqual = std::equal_to<Key>,
-          typename Allocator = std::allocator<std::pair<const Key, T>>>
+          typename Allocator = std::allocator<std::pair<const Key, T>>,
+          typename Layout = DefaultLayout>
 class unordered_node_map
     : public prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, false,
-                                          Allocator> {
+                                          Allocator, Layout> {
  private:
-  using Base =
-      prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, false, Allocator>;
+  using Base = prhdtls::basic_unordered_map<Key, T, Hash, KeyEqual, false,
+                                            Allocator, Layout>;
 
  public:
   using Base::Base;
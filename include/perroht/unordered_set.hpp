@@ -14,13 +14,14 @@
 namespace perroht {
 template <typename Key, typename Hash = std::hash<Key>,
           typename KeyEqual = std::equal_to<Key>,
-          typename Allocator = std::allocator<Key>>
+          typename Allocator = std::allocator<Key>,
+          typename Layout = DefaultLayout>
 class unordered_flat_set
     : public prhdtls::basic_unordered_set<Key, Hash, KeyEqual, true,
-                                          Allocator> {
+                                          Allocator, Layout> {
  private:
-  using Base =
-      prhdtls::basic_unordered_set<Key, Hash, KeyEqual, true, Allocator>;
+  using Base = prhdtls::basic_unordered_set<Key, Hash, KeyEqual, true,
+                                            Allocator, Layout>;
 
  public:
   using Base::Base;
@@ -28,13 +29,14 @@ class unordered_flat_set
 
 template <typename Key, typename Hash = std::hash<Key>,
           typename KeyEqual = std::equal_to<Key>,
-          typename Allocator = std::allocator<Key>>
+          typename Allocator = std::allocator<Key>,
+          typename Layout = DefaultLayout>
 class unordered_node_set
     : public prhdtls::basic_unordered_set<Key, Hash, KeyEqual, false,
-                                          Allocator> {
+                                          Allocator, Layout> {
  private:
-  using Base =
-      prhdtls::basic_unordered_set<Key, Hash, KeyEqual, false, Allocator>;
+  using Base = prhdtls::basic_unordered_set<Key, Hash, KeyEqual, false,
+                                            Allocator, Layout>;
 
  public:
   using Base::Base;
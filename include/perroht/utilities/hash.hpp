@@ -458,7 +458,8 @@ struct Hash {
 };
 
 /// \brief Hash string data.
-/// \tparam string_type A string class.
+/// \tparam string_type A string class, e.g., std::string or std::string_view
+/// (see string_flat_map).
 /// \tparam seed A seed value used for hashing.
 template <typename string_type, uint32_t seed = 123>
 struct StringHash {
@@ -467,7 +468,7 @@ struct StringHash {
 
     uint64_t hash[2];
     perroht::hsdtl::MurmurHash3_x64_128(
-        key.c_str(), key.length() * sizeof(typename string_type::value_type),
+        key.data(), key.length() * sizeof(typename string_type::value_type),
         seed, hash);
     return hash[0];
   }
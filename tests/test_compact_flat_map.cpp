@@ -0,0 +1,185 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <scoped_allocator>
+#include <string>
+#include <utility>
+
+#include <perroht/compact_flat_map.hpp>
+#include <perroht/compact_flat_set.hpp>
+#include <perroht/mmap_allocator.hpp>
+
+#include "test_path.hpp"
+
+using compact_flat_map = perroht::compact_flat_map<uint64_t, uint64_t>;
+using compact_flat_set = perroht::compact_flat_set<int>;
+
+static std::string SegmentPath() {
+  return UniqueTestPath("./test-compact-flat-map");
+}
+
+TEST(CompactFlatMapTest, HandleSize) {
+  EXPECT_EQ(sizeof(compact_flat_map), 2 * sizeof(void*));
+  EXPECT_EQ(sizeof(compact_flat_set), 2 * sizeof(void*));
+
+  // A stateful allocator is held in the handle.
+  using alloc_type = perroht::mmap_allocator<int>;
+  using set_type = perroht::compact_flat_set<int, std::hash<int>,
+                                             std::equal_to<int>, alloc_type>;
+  EXPECT_EQ(sizeof(set_type), 2 * sizeof(void*) + sizeof(alloc_type));
+}
+
+TEST(CompactFlatMapTest, InsertAndFind) {
+  compact_flat_map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), 0);
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_TRUE(map.insert({1, 10}).second);
+  EXPECT_TRUE(map.try_emplace(2, 20).second);
+  EXPECT_TRUE(map.emplace(3, 30).second);
+  map[4] = 40;
+  EXPECT_FALSE(map.insert({1, 11}).second);
+  EXPECT_EQ(map.size(), 4);
+
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.find(2)->second, 20);
+  EXPECT_EQ(map[3], 30);
+  EXPECT_EQ(map.count(4), 1);
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_THROW(map.at(5), std::out_of_range);
+}
+
+TEST(CompactFlatMapTest, LongProbes) {
+  // A constant hash value makes probe distances that exceed the header.
+  struct ConstantHash {
+    std::size_t operator()(int) const { return 0; }
+  };
+  perroht::compact_flat_set<int, ConstantHash> set;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(set.insert(i).second);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_EQ(set.erase(i), 1);
+  }
+  EXPECT_EQ(set.size(), 500);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(set.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(CompactFlatMapTest, LoadFactorIsStoredInTable) {
+  compact_flat_map map;
+  EXPECT_FLOAT_EQ(map.max_load_factor(), 0.875);
+  map.max_load_factor(0.5);
+  EXPECT_FLOAT_EQ(map.max_load_factor(), 0.5);
+  for (uint64_t i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+  EXPECT_LE(map.load_factor(), 0.5);
+  EXPECT_EQ(sizeof(map), 2 * sizeof(void*));
+
+  compact_flat_map copy(map);
+  EXPECT_FLOAT_EQ(copy.max_load_factor(), 0.5);
+  EXPECT_EQ(copy.bucket_count(), map.bucket_count());
+}
+
+TEST(CompactFlatMapTest, NestedCopyMoveAndSwap) {
+  using inner_type = perroht::compact_flat_set<std::string>;
+  using outer_type = perroht::compact_flat_map<int, inner_type>;
+  outer_type outer;
+  for (int i = 0; i < 100; ++i) {
+    for (int j = 0; j <= i % 10; ++j) {
+      outer[i].insert(std::to_string(j));
+    }
+  }
+  outer_type copy(outer);
+  EXPECT_TRUE(copy == outer);
+  copy[0].insert("x");
+  EXPECT_TRUE(copy != outer);
+
+  outer_type moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at(0).size(), 2);
+
+  swap(moved, outer);
+  EXPECT_EQ(outer.at(0).size(), 2);
+  EXPECT_EQ(moved.at(0).size(), 1);
+
+  outer = moved;
+  EXPECT_TRUE(outer == moved);
+  outer.clear();
+  EXPECT_TRUE(outer.empty());
+  outer.rehash(0);
+  EXPECT_EQ(outer.bucket_count(), 0);
+  EXPECT_EQ(outer.begin(), outer.end());
+}
+
+TEST(CompactFlatMapTest, PersistNested) {
+  using inner_alloc_type = perroht::mmap_allocator<int>;
+  using inner_type =
+      perroht::compact_flat_set<int, std::hash<int>, std::equal_to<int>,
+                                inner_alloc_type>;
+  using alloc_type = perroht::mmap_allocator<std::pair<int, inner_type>>;
+  using map_type = perroht::compact_flat_map<int, inner_type, std::hash<int>,
+                                             std::equal_to<int>, alloc_type>;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* map = segment.construct<map_type>("map", alloc_type(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 1000; ++i) {
+      auto& set =
+          map->try_emplace(i, inner_alloc_type(segment)).first->second;
+      for (int j = 0; j < i % 5; ++j) {
+        set.insert(j);
+      }
+    }
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* map = segment.find<map_type>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+      const auto& set = map->at(i);
+      ASSERT_EQ(set.size(), i % 5);
+      for (int j = 0; j < i % 5; ++j) {
+        ASSERT_TRUE(set.contains(j));
+      }
+    }
+    EXPECT_TRUE(segment.destroy<map_type>("map"));
+  }
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(CompactFlatMapTest, ScopedAllocator) {
+  // The inner sets are given the allocator of the map.
+  using inner_alloc_type =
+      std::scoped_allocator_adaptor<perroht::mmap_allocator<int>>;
+  using inner_type =
+      perroht::compact_flat_set<int, std::hash<int>, std::equal_to<int>,
+                                inner_alloc_type>;
+  using alloc_type = std::scoped_allocator_adaptor<
+      perroht::mmap_allocator<std::pair<int, inner_type>>>;
+  using map_type = perroht::compact_flat_map<int, inner_type, std::hash<int>,
+                                             std::equal_to<int>, alloc_type>;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    map_type map{alloc_type(perroht::mmap_allocator<int>(segment))};
+    for (int i = 0; i < 100; ++i) {
+      map[i].insert(i);
+    }
+    EXPECT_EQ(map.at(1).get_allocator(),
+              inner_alloc_type(map.get_allocator()));
+    map_type copy(map);
+    EXPECT_TRUE(copy == map);
+    EXPECT_TRUE(copy.at(99).contains(99));
+  }
+  std::remove(SegmentPath().c_str());
+}
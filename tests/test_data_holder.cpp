@@ -268,6 +268,37 @@ TYPED_TEST(DataHolderTest_Key, Swap) {
   data2.Clear(alloc);
 }
 
+TEST(DataHolderTest, TaggedNode) {
+  using holder_type =
+      perroht::prhdtls::DataHolder<std::vector<int>, false,
+                                   std::allocator<std::vector<int>>, true>;
+  // Leaves a byte for a header in an 8-byte word.
+  EXPECT_EQ(sizeof(holder_type), 7);
+
+  holder_type::AllocatorType alloc;
+  holder_type data(alloc, 10);
+  EXPECT_EQ(data.Fingerprint(), 0);
+  data.SetFingerprint(0xAB);
+  EXPECT_EQ(data.Get().size(), 10);
+
+  // The fingerprint moves with the pointer.
+  holder_type moved(std::move(data));
+  EXPECT_EQ(moved.Fingerprint(), 0xAB);
+  EXPECT_EQ(moved.Get().size(), 10);
+
+  holder_type other(alloc, 20);
+  other.SetFingerprint(0xCD);
+  using std::swap;
+  swap(moved, other);
+  EXPECT_EQ(moved.Get().size(), 20);
+  EXPECT_EQ(moved.Fingerprint(), 0xCD);
+
+  other.MoveAssign(alloc, std::move(moved));
+  EXPECT_EQ(other.Get().size(), 20);
+  EXPECT_EQ(other.Fingerprint(), 0xCD);
+  other.Clear(alloc);
+}
+
 #ifdef USE_PERSISTENT_ALLOCATOR_TEST
 template <typename T>
 class KeyValueMetallOffsetPointerTest : public ::testing::Test {};
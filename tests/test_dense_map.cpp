@@ -0,0 +1,148 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <perroht/dense_map.hpp>
+
+using dense_map = perroht::dense_map<int, std::string>;
+
+TEST(DenseMapTest, InsertAndFind) {
+  dense_map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert({1, "one"}).second);
+  EXPECT_TRUE(map.try_emplace(2, "two").second);
+  EXPECT_TRUE(map.emplace(3, "three").second);
+  map[4] = "four";
+  EXPECT_FALSE(map.insert({1, "uno"}).second);
+  EXPECT_EQ(map.size(), 4);
+
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_EQ(map[3], "three");
+  EXPECT_EQ(map.count(4), 1);
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_THROW(map.at(5), std::out_of_range);
+}
+
+TEST(DenseMapTest, ElementsArePacked) {
+  dense_map map;
+  for (int i = 0; i < 100; ++i) {
+    map[i] = std::to_string(i);
+  }
+  // Elements are stored in insertion order until an element is erased.
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(map.data()[i].first, i);
+  }
+
+  // The last element is moved into the place of the erased one.
+  EXPECT_EQ(map.erase(10), 1);
+  EXPECT_EQ(map.erase(10), 0);
+  EXPECT_EQ(map.size(), 99);
+  EXPECT_EQ(map.data()[10].first, 99);
+  EXPECT_EQ(map.find(99) - map.begin(), 10);
+
+  // Erasing through an iterator returns the same position.
+  auto it = map.erase(map.begin());
+  EXPECT_EQ(it, map.begin());
+  EXPECT_EQ(it->first, 98);
+  it = map.erase(std::prev(map.end()));
+  EXPECT_EQ(it, map.end());
+  EXPECT_EQ(map.size(), 97);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 97);
+}
+
+TEST(DenseMapTest, EraseWhileIterating) {
+  dense_map map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = std::to_string(i);
+  }
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 3 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(map.size(), 666);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map.contains(i), i % 3 != 0);
+  }
+}
+
+TEST(DenseMapTest, RandomOperations) {
+  dense_map map;
+  std::unordered_map<int, std::string> reference;
+  std::mt19937 rnd(42);
+  for (int n = 0; n < 100000; ++n) {
+    const int key = int(rnd() % 2000);
+    if (rnd() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), reference.erase(key));
+    } else {
+      const auto value = std::to_string(n);
+      ASSERT_EQ(map.insert({key, value}).second,
+                reference.insert({key, value}).second);
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto& [key, value] : map) {
+    ASSERT_EQ(reference.at(key), value);
+  }
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+}
+
+TEST(DenseMapTest, CopyAndEquality) {
+  dense_map map;
+  for (int i = 0; i < 100; ++i) {
+    map[i] = std::to_string(i);
+  }
+  dense_map other(map);
+  EXPECT_TRUE(map == other);
+
+  // Equality does not depend on the order of the elements.
+  other.erase(0);
+  other[0] = "0";
+  EXPECT_TRUE(map == other);
+  other[0] = "zero";
+  EXPECT_TRUE(map != other);
+
+  dense_map moved(std::move(other));
+  EXPECT_EQ(moved.size(), 100);
+  moved.swap(map);
+  EXPECT_EQ(map.at(0), "zero");
+  EXPECT_EQ(moved.at(0), "0");
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+}
+
+TEST(DenseMapTest, ThrowingConstructorLeavesNoEntry) {
+  struct Value {
+    explicit Value(const bool fail) {
+      if (fail) {
+        throw std::runtime_error("construction failed");
+      }
+    }
+  };
+  perroht::dense_map<int, Value> map;
+  EXPECT_TRUE(map.try_emplace(1, false).second);
+  EXPECT_THROW(map.try_emplace(2, true), std::runtime_error);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.find(2), map.end());
+  EXPECT_TRUE(map.try_emplace(2, false).second);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.find(2) - map.begin(), 1);
+}
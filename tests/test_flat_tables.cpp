@@ -0,0 +1,105 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+// Tests of the Robin Hood probing shared by the flat maps.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <perroht/compact_flat_map.hpp>
+#include <perroht/int_flat_map.hpp>
+#include <perroht/string_flat_map.hpp>
+
+// Describes a map type and how to make its n-th key.
+template <typename Map, typename Key>
+struct IntegerKeys {
+  using map_type = Map;
+  using key_type = Key;
+
+  static key_type MakeKey(const uint64_t n) { return n; }
+};
+
+struct StringKeys {
+  using map_type = perroht::string_flat_map<uint64_t>;
+  using key_type = std::string;
+
+  // Keys of various lengths, some stored in the arena.
+  static key_type MakeKey(const uint64_t n) {
+    return std::string(n % 40, 'k') + std::to_string(n);
+  }
+};
+
+template <typename T>
+class FlatTablesTest : public ::testing::Test {};
+
+using FlatTableTypes = ::testing::Types<
+    IntegerKeys<perroht::int_flat_map<uint64_t, uint64_t>, uint64_t>,
+    IntegerKeys<perroht::compact_flat_map<uint64_t, uint64_t>, uint64_t>,
+    StringKeys>;
+TYPED_TEST_SUITE(FlatTablesTest, FlatTableTypes);
+
+TYPED_TEST(FlatTablesTest, RandomOperations) {
+  // Few distinct keys make long clusters.
+  using key_type = typename TypeParam::key_type;
+  typename TypeParam::map_type map;
+  std::unordered_map<key_type, uint64_t> reference;
+  std::mt19937_64 rng(123);
+  for (uint64_t i = 0; i < 200000; ++i) {
+    const auto key = TypeParam::MakeKey(rng() % 4096);
+    switch (rng() % 3) {
+      case 0:
+        ASSERT_EQ(map.erase(key), reference.erase(key));
+        break;
+      case 1:
+        if (rng() % 1024 == 0) {
+          map.rehash(0);
+        }
+        [[fallthrough]];
+      default:
+        ASSERT_EQ(map.insert({key, i}).second,
+                  reference.insert({key, i}).second);
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+  std::size_t count = 0;
+  for (const auto& [key, value] : map) {
+    ASSERT_EQ(reference.at(key_type(key)), value);
+    ++count;
+  }
+  EXPECT_EQ(count, reference.size());
+
+  auto copy = map;
+  EXPECT_TRUE(copy == map);
+  copy.erase(reference.begin()->first);
+  EXPECT_TRUE(copy != map);
+}
+
+TYPED_TEST(FlatTablesTest, EraseWhileIterating) {
+  typename TypeParam::map_type map;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    map[TypeParam::MakeKey(i * 7)] = i;
+  }
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->second % 2 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(map.size(), 500);
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(value % 2, 1);
+  }
+  for (uint64_t i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map.count(TypeParam::MakeKey(i * 7)), i % 2);
+  }
+}
@@ -0,0 +1,149 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <perroht/int_flat_map.hpp>
+#include <perroht/int_flat_set.hpp>
+#include <perroht/mmap_allocator.hpp>
+
+#include "test_path.hpp"
+
+using int_flat_map = perroht::int_flat_map<uint64_t, uint64_t>;
+using int_flat_set = perroht::int_flat_set<int>;
+
+static std::string SegmentPath() {
+  return UniqueTestPath("./test-int-flat-map");
+}
+
+TEST(IntFlatMapTest, InsertAndFind) {
+  int_flat_map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert({1, 10}).second);
+  EXPECT_TRUE(map.try_emplace(2, 20).second);
+  EXPECT_TRUE(map.emplace(3, 30).second);
+  map[4] = 40;
+  EXPECT_FALSE(map.insert({1, 11}).second);
+  EXPECT_EQ(map.size(), 4);
+
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.find(2)->second, 20);
+  EXPECT_EQ(map[3], 30);
+  EXPECT_EQ(map.count(4), 1);
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_THROW(map.at(5), std::out_of_range);
+}
+
+TEST(IntFlatMapTest, EmptyKeyIsKeptAside) {
+  // The largest key marks empty positions in the table.
+  const auto empty_key = std::numeric_limits<uint64_t>::max();
+  int_flat_map map;
+  EXPECT_FALSE(map.contains(empty_key));
+  EXPECT_TRUE(map.insert({empty_key, 1}).second);
+  EXPECT_FALSE(map.insert({empty_key, 2}).second);
+  map[0] = 0;
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(empty_key), 1);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 2);
+
+  EXPECT_EQ(map.erase(empty_key), 1);
+  EXPECT_FALSE(map.contains(empty_key));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 1);
+
+  // The side slot is visited last and can be erased through an iterator.
+  map[empty_key] = 2;
+  auto it = map.begin();
+  EXPECT_EQ((++it)->first, empty_key);
+  EXPECT_EQ(map.erase(it), map.end());
+  EXPECT_FALSE(map.contains(empty_key));
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(IntFlatMapTest, RehashCopyAndEquality) {
+  int_flat_map map;
+  map.reserve(1000);
+  const auto capacity = map.bucket_count();
+  for (uint64_t i = 0; i < 1000; ++i) {
+    map[i] = i * 10;
+  }
+  EXPECT_EQ(map.bucket_count(), capacity);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+
+  int_flat_map copy(map);
+  EXPECT_TRUE(copy == map);
+  copy[0] = 1;
+  EXPECT_TRUE(copy != map);
+
+  for (uint64_t i = 0; i < 900; ++i) {
+    map.erase(i);
+  }
+  map.rehash(0);
+  EXPECT_LT(map.bucket_count(), capacity);
+  EXPECT_EQ(map.size(), 100);
+  for (uint64_t i = 900; i < 1000; ++i) {
+    ASSERT_EQ(map.at(i), i * 10);
+  }
+
+  int_flat_map moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 1000);
+  EXPECT_EQ(moved.at(0), 1);
+}
+
+TEST(IntFlatSetTest, InsertEraseAndFind) {
+  int_flat_set set;
+  std::unordered_set<int> reference;
+  std::mt19937 rng(7);
+  for (int i = 0; i < 50000; ++i) {
+    const int key = int(rng() % 2048) - 1024;
+    if (rng() % 2 == 0) {
+      ASSERT_EQ(set.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(set.insert(key).second, reference.insert(key).second);
+    }
+  }
+  EXPECT_TRUE(set.insert(std::numeric_limits<int>::max()).second);
+  reference.insert(std::numeric_limits<int>::max());
+  ASSERT_EQ(set.size(), reference.size());
+  for (const auto key : set) {
+    ASSERT_EQ(reference.count(key), 1);
+  }
+}
+
+TEST(IntFlatMapTest, Persist) {
+  using alloc_type = perroht::mmap_allocator<std::pair<uint64_t, uint64_t>>;
+  using map_type = perroht::int_flat_map<uint64_t, uint64_t,
+                                         std::hash<uint64_t>, alloc_type>;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* map = segment.construct<map_type>("map", alloc_type(segment));
+    ASSERT_NE(map, nullptr);
+    for (uint64_t i = 0; i < 10000; ++i) {
+      (*map)[i] = i + 1;
+    }
+    (*map)[std::numeric_limits<uint64_t>::max()] = 0;
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* map = segment.find<map_type>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->size(), 10001);
+    for (uint64_t i = 0; i < 10000; ++i) {
+      ASSERT_EQ(map->at(i), i + 1);
+    }
+    EXPECT_EQ(map->at(std::numeric_limits<uint64_t>::max()), 0);
+    EXPECT_TRUE(segment.destroy<map_type>("map"));
+  }
+  std::remove(SegmentPath().c_str());
+}
@@ -0,0 +1,490 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <scoped_allocator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <perroht/mmap_allocator.hpp>
+#include <perroht/perroht.hpp>
+
+#include "test_path.hpp"
+
+static std::string SegmentPath() {
+  return UniqueTestPath("./test-mmap-allocator");
+}
+
+using FlatAlloc = perroht::mmap_allocator<std::pair<int, int>>;
+using FlatMap = perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>,
+                                 true, FlatAlloc>;
+using NodeAlloc = perroht::mmap_allocator<std::pair<const int, int>>;
+using NodeMap = perroht::Perroht<int, int, std::hash<int>, std::equal_to<int>,
+                                 false, NodeAlloc>;
+
+// std::hash<int> is the identity function on most platforms; mix the bits to
+// make collisions and clusters.
+struct MixHash {
+  std::size_t operator()(const int x) const {
+    auto z = uint64_t(x) * 0x9e3779b97f4a7c15ULL;
+    return std::size_t(z ^ (z >> 31));
+  }
+};
+using MixedFlatMap = perroht::Perroht<int, int, MixHash, std::equal_to<int>,
+                                      true, FlatAlloc>;
+using MixedNodeMap = perroht::Perroht<int, int, MixHash, std::equal_to<int>,
+                                      false, NodeAlloc>;
+
+TEST(MmapAllocatorTest, AllocateAndDeallocate) {
+  perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+  ASSERT_TRUE(segment.good());
+  perroht::mmap_allocator<int> alloc(segment);
+
+  int* const small = alloc.allocate(4);
+  ASSERT_NE(small, nullptr);
+  small[3] = 3;
+  alloc.deallocate(small, 4);
+  EXPECT_EQ(alloc.allocate(4), small);  // Reused
+
+  // Grows the segment
+  const auto old_size = segment.size();
+  int* const large = alloc.allocate(1 << 20);
+  ASSERT_NE(large, nullptr);
+  large[(1 << 20) - 1] = 1;
+  EXPECT_GT(segment.size(), old_size);
+
+  EXPECT_TRUE(alloc.expand_in_place(large, 1 << 20, 1 << 21));
+  large[(1 << 21) - 1] = 2;
+  EXPECT_FALSE(alloc.expand_in_place(small, 4, 8));
+  alloc.deallocate(large, 1 << 21);
+
+  EXPECT_EQ(alloc, perroht::mmap_allocator<char>(alloc));
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, NamedObjects) {
+  perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+  auto* const value = segment.construct<int>("value", 10);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(segment.construct<int>("value", 20), nullptr);
+  EXPECT_EQ(segment.find<int>("value"), value);
+  EXPECT_TRUE(segment.destroy<int>("value"));
+  EXPECT_EQ(segment.find<int>("value"), nullptr);
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, PersistFlatMap) {
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<FlatMap>("map", FlatAlloc(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 100000; ++i) {
+      map->Insert(std::make_pair(i, i * 2));
+    }
+    EXPECT_TRUE(segment.flush());
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    ASSERT_TRUE(segment.good());
+    auto* const map = segment.find<FlatMap>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_TRUE(map->Recover());
+    EXPECT_EQ(map->Size(), 100000);
+    for (int i = 0; i < 100000; ++i) {
+      ASSERT_EQ(map->Find(i)->second, i * 2);
+    }
+    for (int i = 0; i < 100000; i += 2) {
+      map->Erase(i);
+    }
+    EXPECT_TRUE(map->ShrinkToFit());
+    EXPECT_TRUE(map->CheckIntegrity());
+    EXPECT_TRUE(segment.destroy<FlatMap>("map"));
+  }
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, PersistNodeMap) {
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<NodeMap>("map", NodeAlloc(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 10000; ++i) {
+      map->Insert(std::make_pair(i, i * 3));
+    }
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<NodeMap>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_TRUE(map->Recover());
+    EXPECT_EQ(map->Size(), 10000);
+    for (int i = 0; i < 10000; ++i) {
+      ASSERT_EQ(map->Find(i)->second, i * 3);
+    }
+    EXPECT_TRUE(map->CheckIntegrity());
+    segment.destroy<NodeMap>("map");
+  }
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, MoveBetweenSegments) {
+  const std::string other_path = SegmentPath() + "-other";
+  perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+  perroht::mmap_segment other_segment(other_path, perroht::create_only);
+  auto* const map = segment.construct<FlatMap>("map", FlatAlloc(segment));
+  ASSERT_NE(map, nullptr);
+  for (int i = 0; i < 10000; ++i) {
+    map->Insert(std::make_pair(i, i * 2));
+  }
+  const FlatMap copy(*map, FlatAlloc(other_segment));
+  auto* const moved = other_segment.construct<FlatMap>(
+      "map", std::move(*map), FlatAlloc(other_segment));
+  ASSERT_NE(moved, nullptr);
+  EXPECT_EQ(map->Size(), 0);
+  EXPECT_EQ(moved->Size(), 10000);
+  EXPECT_TRUE(*moved == copy);
+  EXPECT_TRUE(moved->CheckIntegrity());
+  EXPECT_EQ(moved->GetAllocator(), FlatAlloc(other_segment));
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(moved->Find(i)->second, i * 2);
+  }
+  segment.destroy<FlatMap>("map");
+  other_segment.destroy<FlatMap>("map");
+  std::remove(SegmentPath().c_str());
+  std::remove(other_path.c_str());
+}
+
+template <typename Map, typename Alloc>
+void RunMigrateFromDram() {
+  using DramMap = perroht::Perroht<int, int, MixHash, std::equal_to<int>,
+                                   Map::Embed()>;
+  constexpr int kNumElements = 100000;
+  DramMap dram_map;
+  for (int i = 0; i < kNumElements; ++i) {
+    dram_map.Insert(std::make_pair(i, i * 2));
+  }
+  const auto capacity = dram_map.Capacity();
+
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map =
+        segment.construct<Map>("map", std::move(dram_map), Alloc(segment));
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(dram_map.Size(), 0);
+    EXPECT_EQ(dram_map.Capacity(), 0);
+    EXPECT_EQ(map->Size(), kNumElements);
+    EXPECT_EQ(map->Capacity(), capacity);
+    EXPECT_TRUE(map->CheckIntegrity());
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<Map>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_TRUE(map->Recover());
+    EXPECT_EQ(map->Size(), kNumElements);
+    for (int i = 0; i < kNumElements; ++i) {
+      ASSERT_EQ(map->Find(i)->second, i * 2);
+    }
+    segment.destroy<Map>("map");
+  }
+
+  // The source can be reused.
+  dram_map.Insert(std::make_pair(1, 1));
+  EXPECT_EQ(dram_map.Find(1)->second, 1);
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, MigrateFlatMapFromDram) {
+  RunMigrateFromDram<MixedFlatMap, FlatAlloc>();
+}
+
+TEST(MmapAllocatorTest, MigrateNodeMapFromDram) {
+  RunMigrateFromDram<MixedNodeMap, NodeAlloc>();
+}
+
+TEST(MmapAllocatorTest, MigrateBetweenSegments) {
+  // Only the memory of an allocator that supports it is discarded while
+  // migrating; std::allocator blocks may share pages with other objects.
+  static_assert(perroht::prhdtls::HasDiscardPages<FlatAlloc>::value);
+  static_assert(
+      !perroht::prhdtls::HasDiscardPages<std::allocator<int>>::value);
+
+  // Scoped allocators are a different allocator type; the source table is
+  // discarded chunk by chunk as it is migrated.
+  using ScopedAlloc = std::scoped_allocator_adaptor<FlatAlloc>;
+  using ScopedMap = perroht::Perroht<int, int, MixHash, std::equal_to<int>,
+                                     true, ScopedAlloc>;
+  const std::string other_path = SegmentPath() + "-other";
+  perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+  perroht::mmap_segment other_segment(other_path, perroht::create_only);
+  auto* const map = segment.construct<MixedFlatMap>("map", FlatAlloc(segment));
+  ASSERT_NE(map, nullptr);
+  for (int i = 0; i < 100000; ++i) {
+    map->Insert(std::make_pair(i, i * 2));
+  }
+  auto* const moved = other_segment.construct<ScopedMap>(
+      "map", std::move(*map), ScopedAlloc(FlatAlloc(other_segment)));
+  ASSERT_NE(moved, nullptr);
+  EXPECT_EQ(map->Size(), 0);
+  EXPECT_EQ(moved->Size(), 100000);
+  EXPECT_TRUE(moved->CheckIntegrity());
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_EQ(moved->Find(i)->second, i * 2);
+  }
+  map->Insert(std::make_pair(1, 1));
+  EXPECT_EQ(map->Find(1)->second, 1);
+  segment.destroy<MixedFlatMap>("map");
+  other_segment.destroy<ScopedMap>("map");
+  std::remove(SegmentPath().c_str());
+  std::remove(other_path.c_str());
+}
+
+template <typename Map, typename Alloc>
+void RunInPlaceResize() {
+  perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+  auto* const map = segment.construct<Map>("map", Alloc(segment));
+  ASSERT_NE(map, nullptr);
+  ASSERT_TRUE(map->ResizeInPlace(true));
+  map->MaxLoadFactor(0.95);
+
+  constexpr int kNumElements = 200000;
+  for (int i = 0; i < kNumElements; ++i) {
+    map->Insert(std::make_pair(i, i * 2));
+  }
+  EXPECT_TRUE(map->CheckIntegrity());
+  EXPECT_EQ(map->Size(), kNumElements);
+  for (int i = 0; i < kNumElements; ++i) {
+    ASSERT_EQ(map->Find(i)->second, i * 2);
+  }
+
+  // Grow by more than double at once
+  EXPECT_TRUE(map->Reserve(map->Capacity() * 4));
+  EXPECT_TRUE(map->CheckIntegrity());
+
+  for (int i = 0; i < kNumElements; ++i) {
+    if (i % 16 != 0) map->Erase(i);
+  }
+  const auto old_capacity = map->Capacity();
+  EXPECT_TRUE(map->ShrinkToFit());
+  EXPECT_LT(map->Capacity(), old_capacity);
+  EXPECT_TRUE(map->CheckIntegrity());
+  EXPECT_EQ(map->Size(), kNumElements / 16);
+  for (int i = 0; i < kNumElements; i += 16) {
+    ASSERT_EQ(map->Find(i)->second, i * 2);
+  }
+
+  // The table can grow again after being shrunk.
+  for (int i = 0; i < kNumElements; ++i) {
+    map->Insert(std::make_pair(i, i * 2));
+  }
+  EXPECT_TRUE(map->CheckIntegrity());
+  EXPECT_EQ(map->Size(), kNumElements);
+  EXPECT_TRUE(map->Recover());
+
+  segment.destroy<Map>("map");
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, InPlaceResizeFlatMap) {
+  RunInPlaceResize<MixedFlatMap, FlatAlloc>();
+}
+
+TEST(MmapAllocatorTest, InPlaceResizeNodeMap) {
+  RunInPlaceResize<MixedNodeMap, NodeAlloc>();
+}
+
+TEST(MmapAllocatorTest, InPlaceResizePeakMemory) {
+  std::size_t segment_sizes[2];
+  for (int in_place = 0; in_place < 2; ++in_place) {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<FlatMap>("map", FlatAlloc(segment));
+    ASSERT_NE(map, nullptr);
+    ASSERT_TRUE(map->ResizeInPlace(in_place));
+    for (int i = 0; i < (1 << 20); ++i) {
+      map->Insert(std::make_pair(i, i));
+    }
+    segment_sizes[in_place] = segment.size();
+    segment.destroy<FlatMap>("map");
+  }
+  // The old table does not coexist with the new one.
+  EXPECT_LT(segment_sizes[1], segment_sizes[0]);
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, InPlaceResizeRequiresAllocatorSupport) {
+  perroht::Perroht<int, int> map;
+  EXPECT_FALSE(map.ResizeInPlace(true));
+  EXPECT_FALSE(map.ResizingInPlace());
+  EXPECT_TRUE(map.ResizeInPlace(false));
+}
+
+template <typename Map, typename Alloc>
+void RunWarmUpAfterReopen() {
+  constexpr int kNumElements = 200000;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<Map>("map", Alloc(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < kNumElements; ++i) {
+      map->Insert(std::make_pair(i, i * 2));
+    }
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<Map>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_TRUE(map->Recover());
+
+    auto task = map->WarmUp(2);
+    ASSERT_NE(task, nullptr);
+    // Lookups are served while the table is warming up.
+    for (int i = 0; i < kNumElements; i += 7) {
+      ASSERT_EQ(map->Find(i)->second, i * 2);
+    }
+    task->Wait();
+    EXPECT_TRUE(task->Done());
+    EXPECT_DOUBLE_EQ(task->Progress(), 1.0);
+    task.reset();
+
+    // Destroying a task cancels the remaining work.
+    map->WarmUp(1).reset();
+    EXPECT_TRUE(map->CheckIntegrity());
+    segment.destroy<Map>("map");
+  }
+  std::remove(SegmentPath().c_str());
+}
+
+TEST(MmapAllocatorTest, WarmUpFlatMap) {
+  RunWarmUpAfterReopen<MixedFlatMap, FlatAlloc>();
+}
+
+TEST(MmapAllocatorTest, WarmUpNodeMap) {
+  RunWarmUpAfterReopen<MixedNodeMap, NodeAlloc>();
+}
+
+TEST(MmapAllocatorTest, WarmUpEmptyMap) {
+  perroht::Perroht<int, int> map;
+  auto task = map.WarmUp();
+  task->Wait();
+  EXPECT_TRUE(task->Done());
+  EXPECT_DOUBLE_EQ(task->Progress(), 1.0);
+}
+
+// Terminates the process after the given number of hash computations, unless
+// it is negative.
+static int num_hashes_to_crash = -1;
+struct CrashingHash {
+  std::size_t operator()(const int x) const {
+    if (num_hashes_to_crash >= 0 && num_hashes_to_crash-- == 0) {
+      std::_Exit(0);
+    }
+    return MixHash()(x);
+  }
+};
+
+TEST(MmapAllocatorTest, RecoverInterruptedBatch) {
+  using MapType = perroht::Perroht<int, int, CrashingHash, std::equal_to<int>,
+                                   true, FlatAlloc>;
+  using Op = MapType::BatchOperation;
+  std::vector<Op> ops;
+  for (int i = 0; i < 2000; ++i) {
+    ops.push_back(Op::Erase(i * 2));
+    ops.push_back(Op::Insert(std::make_pair(10000 + i, i)));
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<MapType>("map", FlatAlloc(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 10000; ++i) {
+      map->Insert(std::make_pair(i, i * 2));
+    }
+    ASSERT_TRUE(map->Reserve(map->Capacity() * 2));
+    EXPECT_TRUE(segment.flush());
+  }
+
+  // Apply the batch in another process that dies halfway through.
+  const pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<MapType>("map");
+    num_hashes_to_crash = int(ops.size() * 3 / 2);
+    map->ApplyBatch(ops);
+    std::_Exit(1);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<MapType>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->NumPendingBatchOperations(), ops.size());
+    EXPECT_TRUE(map->Recover());
+    EXPECT_EQ(map->NumPendingBatchOperations(), 0);
+    EXPECT_TRUE(map->CheckIntegrity());
+    EXPECT_EQ(map->Size(), 10000);
+    for (int i = 0; i < 10000; ++i) {
+      ASSERT_EQ(map->Contains(i), i % 2 == 1 || i >= 4000);
+    }
+    for (int i = 0; i < 2000; ++i) {
+      ASSERT_EQ(map->Find(10000 + i)->second, i);
+    }
+    EXPECT_TRUE(segment.destroy<MapType>("map"));
+  }
+  std::remove(SegmentPath().c_str());
+}
+
+template <typename T>
+using ScopedAlloc = std::scoped_allocator_adaptor<perroht::mmap_allocator<T>>;
+
+TEST(MmapAllocatorTest, ScopedAllocatorNestedMap) {
+  // The inner sets are given the allocator of the map.
+  using SetType = perroht::Perroht<int, perroht::VoidValue, std::hash<int>,
+                                   std::equal_to<int>, true, ScopedAlloc<int>>;
+  using MapType =
+      perroht::Perroht<int, SetType, std::hash<int>, std::equal_to<int>, true,
+                       ScopedAlloc<std::pair<int, SetType>>>;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* const map = segment.construct<MapType>(
+        "map", ScopedAlloc<int>(perroht::mmap_allocator<int>(segment)));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 1000; ++i) {
+      auto& set = map->TryEmplace(i).first->second;
+      for (int j = 0; j < i % 5; ++j) {
+        set.Insert(j);
+      }
+    }
+    const auto& set = map->Find(1)->second;
+    EXPECT_EQ(set.GetAllocator(), SetType::Allocator(map->GetAllocator()));
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* const map = segment.find<MapType>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->Size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+      const auto& set = map->Find(i)->second;
+      ASSERT_EQ(set.Size(), i % 5);
+      for (int j = 0; j < i % 5; ++j) {
+        ASSERT_TRUE(set.Contains(j));
+      }
+    }
+    segment.destroy<MapType>("map");
+  }
+  std::remove(SegmentPath().c_str());
+}
@@ -0,0 +1,23 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+/// Return a file path that is unique to the running test.
+/// gtest_discover_tests registers each test case as its own ctest test, and
+/// 'ctest -j' runs them concurrently; thus, test cases must not share files.
+inline std::string UniqueTestPath(const std::string& prefix) {
+  const auto* const info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  std::string name = std::string(info->test_suite_name()) + "-" + info->name();
+  // Typed and parameterized tests have '/' in their names.
+  std::replace(name.begin(), name.end(), '/', '_');
+  return prefix + "-" + name;
+}
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <perroht/perroht.hpp>
+#include <perroht/transaction.hpp>
 
 #ifdef USE_PERSISTENT_ALLOCATOR_TEST
 #include <metall/metall.hpp>
@@ -14,7 +15,16 @@
 #include <metall/container/scoped_allocator.hpp>
 #endif
 
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 using PerrohtContainer = perroht::Perroht<int, int>;
@@ -99,6 +109,29 @@ TYPED_TEST(PerrohtUniqueTest_KeyValue, MoveConstructor) {
   EXPECT_EQ(move_perroht.Count(4), 1);
 }
 
+TYPED_TEST(PerrohtUniqueTest_KeyValue, CopyLargeTable) {
+  TypeParam* perroht = this->perroht_;
+  for (int i = 0; i < 10000; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  TypeParam copy_perroht(*perroht);
+  EXPECT_EQ(copy_perroht.Size(), perroht->Size());
+  EXPECT_EQ(copy_perroht.Capacity(), perroht->Capacity());
+  EXPECT_TRUE(copy_perroht == *perroht);
+  EXPECT_TRUE(copy_perroht.CheckIntegrity());
+
+  // The copy is independent of the original.
+  copy_perroht.Erase(0);
+  copy_perroht.Insert(std::make_pair(10000, 0));
+  EXPECT_EQ(perroht->Count(0), 1);
+  EXPECT_EQ(perroht->Count(10000), 0);
+  EXPECT_TRUE(copy_perroht != *perroht);
+
+  copy_perroht = *perroht;
+  EXPECT_TRUE(copy_perroht == *perroht);
+  EXPECT_TRUE(copy_perroht.CheckIntegrity());
+}
+
 TYPED_TEST(PerrohtUniqueTest_KeyValue, Empty) {
   TypeParam* perroht = this->perroht_;
   EXPECT_TRUE(perroht->Empty())
@@ -389,6 +422,640 @@ TYPED_TEST(PerrohtUniqueTest_KeyValue_CustomHash, Insert) {
   EXPECT_EQ(ret->second, 13);
 }
 
+TYPED_TEST(PerrohtUniqueTest_KeyValue_CustomHash, Resize) {
+  // The custom hash function returns even numbers only, which makes long
+  // clusters and entries that wrap around the end of the table.
+  TypeParam* perroht = this->perroht_;
+  perroht->MaxLoadFactor(0.95);
+  for (int i = 0; i < 4096; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_TRUE(perroht->CheckIntegrity());
+  EXPECT_TRUE(perroht->Reserve(perroht->Capacity() * 8));
+  EXPECT_TRUE(perroht->CheckIntegrity());
+  EXPECT_TRUE(perroht->Rehash(perroht->Capacity()));
+  EXPECT_TRUE(perroht->CheckIntegrity());
+  EXPECT_TRUE(perroht->ShrinkToFit());
+  EXPECT_TRUE(perroht->CheckIntegrity());
+  EXPECT_EQ(perroht->Size(), 4096);
+  for (int i = 0; i < 4096; ++i) {
+    ASSERT_EQ(perroht->Find(i)->second, i * 10);
+  }
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue_CustomHash, EqualityWithDifferentLayouts) {
+  // Colliding keys inserted in different orders are placed at different
+  // positions in tables of the same capacity.
+  TypeParam* perroht = this->perroht_;
+  TypeParam other(*perroht);
+  for (int i = 0; i < 1000; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+    other.Insert(std::make_pair(999 - i, (999 - i) * 10));
+  }
+  ASSERT_EQ(perroht->Capacity(), other.Capacity());
+  EXPECT_TRUE(*perroht == other);
+  other.Erase(500);
+  other.Insert(std::make_pair(500, 0));
+  EXPECT_FALSE(*perroht == other);
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue_CustomHash, View) {
+  TypeParam* perroht = this->perroht_;
+  {
+    auto view = perroht->GetView();
+    EXPECT_EQ(view.Find(0), nullptr);
+    // Insertions grow the table through the view.
+    for (int i = 0; i < 4096; ++i) {
+      const auto [kv, inserted] = view.Insert(std::make_pair(i, i * 10));
+      ASSERT_TRUE(inserted);
+      ASSERT_EQ(kv->first, i);
+    }
+    EXPECT_FALSE(view.Insert(std::make_pair(0, 1)).second);
+    EXPECT_EQ(view.Capacity(), perroht->Capacity());
+    EXPECT_EQ(view.Size(), 4096);
+    for (int i = 0; i < 4096; ++i) {
+      ASSERT_EQ(view.Find(i)->second, i * 10);
+    }
+    for (int i = 0; i < 4096; i += 2) {
+      ASSERT_EQ(view.Erase(i), 1);
+    }
+    EXPECT_EQ(view.Erase(0), 0);
+    view.Find(1)->second = 1;
+  }
+  EXPECT_TRUE(perroht->CheckIntegrity());
+  EXPECT_EQ(perroht->Size(), 2048);
+  EXPECT_EQ(perroht->Find(1)->second, 1);
+
+  const auto* const const_perroht = perroht;
+  auto view = const_perroht->GetView();
+  for (int i = 0; i < 4096; ++i) {
+    ASSERT_EQ(view.Count(i), i % 2);
+    ASSERT_EQ(view.Contains(i), perroht->Contains(i));
+  }
+
+  // Refresh the view after modifying the container directly.
+  EXPECT_TRUE(perroht->Reserve(perroht->Capacity() * 4));
+  view.Refresh();
+  EXPECT_EQ(view.Capacity(), perroht->Capacity());
+  EXPECT_EQ(view.Find(3)->second, 30);
+}
+
+template <typename Layout>
+using PerrohtContainer_Layout =
+    perroht::Perroht<int, int, CustomHash, std::equal_to<int>, true,
+                     std::allocator<std::pair<int, int>>, Layout>;
+
+// Tables with different layouts can be used in the same program.
+template <typename T>
+class PerrohtLayoutTest : public ::testing::Test {};
+
+using LayoutMapTypes =
+    ::testing::Types<PerrohtContainer_Layout<perroht::InterleavedLayout>,
+                     PerrohtContainer_Layout<perroht::SeparateHeaderLayout>,
+                     PerrohtContainer_Layout<perroht::SeparateKeyLayout>,
+                     PerrohtContainer_Layout<perroht::GroupedHeaderLayout>,
+                     PerrohtContainer_Layout<perroht::TaggedNodeLayout>>;
+TYPED_TEST_SUITE(PerrohtLayoutTest, LayoutMapTypes);
+
+TYPED_TEST(PerrohtLayoutTest, ResizeAndErase) {
+  TypeParam perroht;
+  perroht.MaxLoadFactor(0.95);
+  for (int i = 0; i < 4096; ++i) {
+    perroht.Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(perroht.Reserve(perroht.Capacity() * 8));
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 4096; i += 2) {
+    EXPECT_TRUE(perroht.Erase(i));
+  }
+  EXPECT_TRUE(perroht.ShrinkToFit());
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_EQ(perroht.Size(), 2048);
+  for (int i = 0; i < 4096; ++i) {
+    if (i % 2 == 0) {
+      ASSERT_FALSE(perroht.Contains(i));
+    } else {
+      ASSERT_EQ(perroht.Find(i)->second, i * 10);
+    }
+  }
+
+  TypeParam copy(perroht);
+  EXPECT_TRUE(copy == perroht);
+}
+
+TEST(PerrohtTaggedNodeTest, StringKeys) {
+  using map_type =
+      perroht::Perroht<std::string, int, std::hash<std::string>,
+                       std::equal_to<std::string>, false,
+                       std::allocator<std::pair<const std::string, int>>,
+                       perroht::TaggedNodeLayout>;
+  map_type perroht;
+  perroht.MaxLoadFactor(0.95);
+  for (int i = 0; i < 10000; ++i) {
+    perroht.Insert(std::make_pair(std::to_string(i), i));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10000; i += 3) {
+    EXPECT_TRUE(perroht.Erase(std::to_string(i)));
+  }
+  EXPECT_TRUE(perroht.Rehash(perroht.Capacity() * 2));
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10000; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_FALSE(perroht.Contains(std::to_string(i)));
+    } else {
+      ASSERT_EQ(perroht.Find(std::to_string(i))->second, i);
+    }
+  }
+
+  // Copies recompute the fingerprints of their own nodes.
+  map_type copy(perroht);
+  EXPECT_TRUE(copy.CheckIntegrity());
+  EXPECT_TRUE(copy == perroht);
+  map_type moved(std::move(copy));
+  EXPECT_TRUE(moved.CheckIntegrity());
+  EXPECT_EQ(moved.Find("1")->second, 1);
+}
+
+// Neither default constructible nor copyable.
+struct MoveOnlyValue {
+  explicit MoveOnlyValue(std::unique_ptr<int> p) : ptr(std::move(p)) {}
+  std::unique_ptr<int> ptr;
+};
+
+template <bool embed>
+void RunTryEmplaceForwardsArguments() {
+  perroht::Perroht<int, MoveOnlyValue, std::hash<int>, std::equal_to<int>,
+                   embed>
+      perroht;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(perroht.TryEmplace(i, std::make_unique<int>(i)).second);
+  }
+  // The arguments are not consumed if the key exists.
+  auto ptr = std::make_unique<int>(-1);
+  EXPECT_FALSE(perroht.TryEmplace(0, std::move(ptr)).second);
+  EXPECT_NE(ptr, nullptr);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(*perroht.Find(i)->second.ptr, i);
+  }
+}
+
+TEST(PerrohtTryEmplaceTest, ForwardsArguments) {
+  RunTryEmplaceForwardsArguments<true>();
+  RunTryEmplaceForwardsArguments<false>();
+}
+
+// Throws when constructed for the key 7.
+template <bool kRelocatable>
+struct ThrowingValue {
+  explicit ThrowingValue(const int key)
+      : name(std::make_unique<std::string>(std::string(40, 'v') +
+                                           std::to_string(key))) {
+    if (key == 7) {
+      throw std::runtime_error("construction failed");
+    }
+  }
+  std::unique_ptr<std::string> name;
+};
+
+template <>
+struct perroht::IsTriviallyRelocatable<ThrowingValue<true>>
+    : std::true_type {};
+
+// 7 lands in the middle of the run of the other keys.
+struct CollidingHash {
+  std::size_t operator()(const int key) const noexcept {
+    return key == 7 ? 0 : key / 10;
+  }
+};
+
+template <bool embed, bool relocatable>
+void RunThrowingConstructorLeavesNoEntry() {
+  perroht::Perroht<int, ThrowingValue<relocatable>, CollidingHash,
+                   std::equal_to<int>, embed>
+      perroht;
+  const std::vector<int> keys = {0, 1, 10, 20, 30};
+  for (const int key : keys) {
+    ASSERT_TRUE(perroht.TryEmplace(key, key).second);
+  }
+  const auto histogram = perroht.GetProbeDistanceHistogram();
+
+  // 7 takes the position of 10, and 10, 20, and 30 are shifted before the
+  // value is constructed.
+  EXPECT_THROW(perroht.TryEmplace(7, 7), std::runtime_error);
+  EXPECT_EQ(perroht.Size(), keys.size());
+  EXPECT_FALSE(perroht.Contains(7));
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_EQ(perroht.GetProbeDistanceHistogram(), histogram);
+  EXPECT_EQ(std::distance(perroht.Begin(), perroht.End()), keys.size());
+  for (const int key : keys) {
+    ASSERT_EQ(*perroht.Find(key)->second.name,
+              std::string(40, 'v') + std::to_string(key));
+  }
+
+  EXPECT_TRUE(perroht.TryEmplace(8, 8).second);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_EQ(perroht.Size(), keys.size() + 1);
+}
+
+TEST(PerrohtTryEmplaceTest, ThrowingConstructorLeavesNoEntry) {
+  RunThrowingConstructorLeavesNoEntry<true, false>();
+  RunThrowingConstructorLeavesNoEntry<true, true>();
+  RunThrowingConstructorLeavesNoEntry<false, false>();
+}
+
+// A unique_ptr can be moved by copying its bytes.
+template <>
+struct perroht::IsTriviallyRelocatable<MoveOnlyValue> : std::true_type {};
+
+template <typename Layout>
+void RunRelocatableValues() {
+  using map_type =
+      perroht::Perroht<int, MoveOnlyValue, CustomHash, std::equal_to<int>,
+                       true, std::allocator<std::pair<int, MoveOnlyValue>>,
+                       Layout>;
+  map_type perroht;
+  perroht.MaxLoadFactor(0.95);
+  std::unordered_map<int, int> reference;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 20000; ++i) {
+    const int key = int(rng() % 512);
+    if (rng() % 2 == 0) {
+      ASSERT_EQ(perroht.Erase(key), reference.erase(key) == 1);
+    } else {
+      ASSERT_EQ(perroht.TryEmplace(key, std::make_unique<int>(i)).second,
+                reference.emplace(key, i).second);
+    }
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  ASSERT_EQ(perroht.Size(), reference.size());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(*perroht.Find(key)->second.ptr, value);
+  }
+  EXPECT_TRUE(perroht.Reserve(perroht.Capacity() * 4));
+  EXPECT_TRUE(perroht.ShrinkToFit());
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(*perroht.Find(key)->second.ptr, value);
+  }
+}
+
+TEST(PerrohtRelocationTest, RelocatableValues) {
+  static_assert(perroht::IsTriviallyRelocatableV<std::pair<const int, int>>);
+  static_assert(!perroht::IsTriviallyRelocatableV<std::string>);
+  RunRelocatableValues<perroht::InterleavedLayout>();
+  RunRelocatableValues<perroht::SeparateHeaderLayout>();
+  RunRelocatableValues<perroht::SeparateKeyLayout>();
+  RunRelocatableValues<perroht::GroupedHeaderLayout>();
+}
+
+// Counts the moves of a large value.
+struct FatValue {
+  explicit FatValue(const int v) { data.fill(v); }
+  FatValue(const FatValue&) = default;
+  FatValue(FatValue&& other) noexcept : data(other.data) { ++num_moves; }
+  FatValue& operator=(FatValue&& other) noexcept {
+    data = other.data;
+    ++num_moves;
+    return *this;
+  }
+  std::array<uint64_t, 32> data{};
+  static inline int num_moves = 0;
+};
+
+struct IdentityHash {
+  std::size_t operator()(const int key) const noexcept { return key; }
+};
+
+TEST(PerrohtInsertionTest, DisplacedEntriesAreMovedOnce) {
+  perroht::Perroht<int, FatValue, IdentityHash> perroht;
+  perroht.Reserve(128);
+  for (int i = 10; i < 60; ++i) {
+    perroht.TryEmplace(i, i);
+  }
+  EXPECT_EQ(FatValue::num_moves, 0);
+
+  // Lands at position 11 and displaces the 49 entries that follow.
+  const int key = 10 + int(perroht.Capacity());
+  ASSERT_TRUE(perroht.TryEmplace(key, key).second);
+  EXPECT_EQ(FatValue::num_moves, 49);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 10; i < 60; ++i) {
+    ASSERT_EQ(perroht.Find(i)->second.data[0], i);
+  }
+  EXPECT_EQ(perroht.Find(key)->second.data[31], key);
+
+  // The value is copied before the entries are moved.
+  ASSERT_TRUE(perroht.TryEmplace(key + 1, perroht.Find(30)->second).second);
+  EXPECT_EQ(perroht.Find(key + 1)->second.data[0], 30);
+  EXPECT_EQ(perroht.Find(30)->second.data[0], 30);
+}
+
+TEST(PerrohtIteratorTest, EraseShiftingWrappedEntryVisitsOnce) {
+  // Places num_keys keys from the given position from the last one on and
+  // erases the first while iterating; the entry at position 0 is shifted to
+  // the last position.
+  const auto erase_while_iterating = [](const int num_keys,
+                                        const int from_last) {
+    perroht::Perroht<int, int, IdentityHash> perroht;
+    perroht.Reserve(8);
+    const int capacity = perroht.Capacity();
+    const int erased = capacity - 1 - from_last;
+    for (int i = 0; i < num_keys; ++i) {
+      ASSERT_TRUE(perroht.Insert({erased + i * capacity, i}).second);
+    }
+    std::unordered_map<int, int> visits;
+    for (auto it = perroht.Begin(); it != perroht.End();) {
+      ++visits[it->first];
+      if (it->first == erased) {
+        it = perroht.Erase(it);
+      } else {
+        ++it;
+      }
+    }
+    EXPECT_EQ(visits.size(), std::size_t(num_keys));
+    for (const auto& [key, count] : visits) {
+      EXPECT_EQ(count, 1) << key;
+    }
+    EXPECT_EQ(perroht.Size(), std::size_t(num_keys - 1));
+    EXPECT_TRUE(perroht.CheckIntegrity());
+  };
+
+  erase_while_iterating(2, 0);
+  erase_while_iterating(3, 1);
+  erase_while_iterating(4, 1);
+}
+
+// Probe distances too long to be held in the headers.
+struct DividingHash {
+  std::size_t operator()(const int key) const noexcept { return key / 8; }
+};
+
+TEST(PerrohtInsertionTest, LongRuns) {
+  perroht::Perroht<int, int, DividingHash> perroht;
+  std::unordered_map<int, int> reference;
+  std::mt19937 rng(17);
+  for (int i = 0; i < 20000; ++i) {
+    const int key = int(rng() % 4096);
+    if (rng() % 4 == 0) {
+      ASSERT_EQ(perroht.Erase(key), reference.erase(key) == 1);
+    } else {
+      ASSERT_EQ(perroht.Insert({key, i}).second,
+                reference.emplace(key, i).second);
+    }
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  ASSERT_EQ(perroht.Size(), reference.size());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(perroht.Find(key)->second, value);
+  }
+}
+
+template <int kDivisor>
+struct DividingBy {
+  std::size_t operator()(const int key) const noexcept {
+    return key / kDivisor;
+  }
+};
+
+TEST(PerrohtStashTest, StashesFarElements) {
+  perroht::Perroht<int, int, DividingBy<16>> perroht;
+  perroht.Reserve(1024);
+  const auto capacity = perroht.Capacity();
+  perroht.StashProbeBound(3);
+  EXPECT_EQ(perroht.StashProbeBound(), 3);
+
+  // Keys 0 to 15 have the same ideal position.
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(perroht.Insert({i, i}).second);
+  }
+  EXPECT_EQ(perroht.StashSize(), 6);
+  EXPECT_EQ(perroht.Size(), 10);
+  EXPECT_EQ(perroht.Capacity(), capacity);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(perroht.Find(i)->second, i);
+  }
+  EXPECT_FALSE(perroht.Insert({9, 0}).second);
+  EXPECT_EQ(std::distance(perroht.Begin(), perroht.End()), 10);
+
+  auto copy(perroht);
+  EXPECT_EQ(copy.StashSize(), 6);
+  EXPECT_TRUE(copy == perroht);
+
+  // Stashed elements stay stashed if they are still too far.
+  EXPECT_TRUE(perroht.Reserve(capacity * 2));
+  EXPECT_EQ(perroht.StashSize(), 6);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(copy == perroht);
+
+  EXPECT_EQ(perroht.Erase(8), 1);
+  EXPECT_EQ(perroht.StashSize(), 5);
+  for (auto it = perroht.Begin(); it != perroht.End();) {
+    if (it->first % 2 == 0) {
+      it = perroht.Erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(perroht.Size(), 5);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(perroht.Contains(i), i % 2 == 1);
+  }
+
+  // A snapshot covers the table only; the stash is emptied.
+  auto snapshot = perroht.TakeSnapshot();
+  EXPECT_EQ(perroht.StashSize(), 0);
+  ASSERT_TRUE(perroht.Insert({11, 11}).second);
+  EXPECT_EQ(perroht.StashSize(), 0);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+}
+
+TEST(PerrohtStashTest, StashesAfterBatch) {
+  using Container = perroht::Perroht<int, int, DividingBy<16>>;
+  using Op = Container::BatchOperation;
+  Container perroht;
+  perroht.Reserve(1024);
+  EXPECT_EQ(perroht.StashProbeBound(),
+            std::numeric_limits<std::size_t>::max());
+  perroht.StashProbeBound(3);
+
+  // Nothing is stashed while a batch is applied.
+  std::vector<Op> ops;
+  for (int i = 0; i < 8; ++i) {
+    ops.push_back(Op::Insert(std::make_pair(i, i)));
+  }
+  EXPECT_TRUE(perroht.ApplyBatch(ops));
+  EXPECT_EQ(perroht.StashSize(), 0);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+
+  // The stash is used again once the batch is done.
+  for (int i = 160; i < 170; ++i) {
+    ASSERT_TRUE(perroht.Insert({i, i}).second);
+  }
+  EXPECT_EQ(perroht.StashSize(), 6);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+}
+
+TEST(PerrohtStashTest, EvictsPushedElements) {
+  perroht::Perroht<int, int, DividingBy<16>> perroht;
+  perroht.Reserve(1024);
+  perroht.StashProbeBound(3);
+  for (int i = 16; i < 20; ++i) {
+    perroht.Insert({i, i});
+  }
+  perroht.Insert({0, 0});
+  EXPECT_EQ(perroht.StashSize(), 0);
+
+  // Pushes the run of keys 16 to 19 by one position.
+  perroht.Insert({1, 1});
+  EXPECT_EQ(perroht.StashSize(), 1);
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  const auto [min, mean, max] = perroht.GetProbeDistanceStats();
+  EXPECT_LE(max, 3);
+  for (const int key : {0, 1, 16, 17, 18, 19}) {
+    ASSERT_EQ(perroht.Find(key)->second, key);
+  }
+}
+
+TEST(PerrohtStashTest, MeanProbeDistanceExcludesStash) {
+  perroht::Perroht<int, int, IdentityHash> perroht;
+  perroht.Reserve(64);
+  const int capacity = perroht.Capacity();
+  perroht.StashProbeBound(2);
+
+  // Keys 0 and 64 share position 0, keys 1 and 65 position 1.
+  for (const int key : {0, capacity, 1, capacity + 1}) {
+    ASSERT_TRUE(perroht.Insert({key, key}).second);
+  }
+  ASSERT_EQ(perroht.StashSize(), 0);
+  // Displaces key 1, which pushes key 65 beyond the bound.
+  ASSERT_TRUE(perroht.Insert({capacity * 2, 0}).second);
+  ASSERT_EQ(perroht.StashSize(), 1);
+  ASSERT_TRUE(perroht.Insert({capacity / 2, 0}).second);
+
+  const auto histogram = perroht.GetProbeDistanceHistogram();
+  std::size_t num_entries = 0;
+  std::size_t sum = 0;
+  for (std::size_t d = 0; d < histogram.size(); ++d) {
+    num_entries += histogram[d];
+    sum += d * histogram[d];
+  }
+  ASSERT_EQ(num_entries, perroht.Size() - perroht.StashSize());
+  EXPECT_EQ(sum, num_entries);
+  EXPECT_EQ(perroht.GetApproximateMeanProbeDistance(), sum / num_entries);
+}
+
+TEST(PerrohtStashTest, RandomOperations) {
+  using map_type = perroht::Perroht<int, std::string, DividingBy<4>>;
+  map_type perroht;
+  perroht.StashProbeBound(2);
+  std::unordered_map<int, std::string> reference;
+  std::mt19937 rng(5);
+  for (int i = 0; i < 50000; ++i) {
+    const int key = int(rng() % 2048);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(perroht.Erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(perroht.TryEmplace(key, std::to_string(i)).second,
+                reference.emplace(key, std::to_string(i)).second);
+    }
+    ASSERT_LE(perroht.StashSize(), perroht.Size());
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  ASSERT_EQ(perroht.Size(), reference.size());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(perroht.Find(key)->second, value);
+  }
+  EXPECT_EQ(std::distance(perroht.Begin(), perroht.End()),
+            std::ptrdiff_t(reference.size()));
+
+  map_type moved(std::move(perroht));
+  EXPECT_TRUE(moved.ShrinkToFit());
+  EXPECT_TRUE(moved.CheckIntegrity());
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(moved.Find(key)->second, value);
+  }
+}
+
+TEST(PerrohtSideStateTest, SettingsMoveWithTheTable) {
+  using Container = perroht::Perroht<uint64_t, uint64_t>;
+  constexpr auto kNoBound = std::numeric_limits<std::size_t>::max();
+  // The state of the rarely used features is kept out of the container.
+  EXPECT_LE(sizeof(Container), 6 * sizeof(void*));
+
+  // The stash bound is separate from the limit of the table.
+  static_assert(Container::MaxProbeDistance() > 3);
+
+  Container perroht;
+  perroht.StashProbeBound(3);
+  EXPECT_TRUE(perroht.TrackDirtyPages(true));
+  for (uint64_t i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(perroht.Insert({i, i}).second);
+  }
+  Container moved(std::move(perroht));
+  EXPECT_EQ(moved.StashProbeBound(), 3);
+  EXPECT_TRUE(moved.TrackingDirtyPages());
+  EXPECT_GT(moved.NumDirtyPages(), 0);
+  EXPECT_EQ(perroht.StashProbeBound(), kNoBound);
+  EXPECT_FALSE(perroht.TrackingDirtyPages());
+
+  // Copies take the probe distance bound only.
+  Container copy(moved);
+  EXPECT_EQ(copy.StashProbeBound(), 3);
+  EXPECT_FALSE(copy.TrackingDirtyPages());
+
+  EXPECT_TRUE(moved.TrackDirtyPages(false));
+  moved.StashProbeBound(kNoBound);
+  EXPECT_EQ(moved.NumDirtyPages(), 0);
+  for (uint64_t i = 1000; i < 5000; ++i) {
+    ASSERT_TRUE(moved.Insert({i, i}).second);
+  }
+  EXPECT_EQ(moved.Size(), 5000);
+  EXPECT_TRUE(moved.CheckIntegrity());
+}
+
+// Returns true if one of the ranges covers [addr, addr + length).
+static bool CoversRange(
+    const std::vector<perroht::prhdtls::MemoryRange>& ranges,
+    const void* const addr, const std::size_t length) {
+  const auto begin = reinterpret_cast<std::uintptr_t>(addr);
+  for (const auto& range : ranges) {
+    const auto range_begin = reinterpret_cast<std::uintptr_t>(range.addr);
+    if (range_begin <= begin && begin + length <= range_begin + range.length) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST(PerrohtSideStateTest, SyncFlushesHandleAndStash) {
+  perroht::Perroht<int, int, DividingBy<16>> perroht;
+  perroht.Reserve(1024);
+  perroht.StashProbeBound(3);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(perroht.Insert({i, i}).second);
+  }
+  ASSERT_EQ(perroht.StashSize(), 6);
+
+  EXPECT_TRUE(perroht.TrackDirtyPages(true));
+  ASSERT_TRUE(perroht.Insert({1000, 0}).second);
+  const auto ranges = perroht.TakeSyncRanges();
+  EXPECT_EQ(perroht.NumDirtyPages(), 0);
+  EXPECT_TRUE(CoversRange(ranges, &perroht, sizeof(perroht)));
+  EXPECT_TRUE(CoversRange(ranges, &*perroht.Find(1000), sizeof(int) * 2));
+
+  // Stashed elements are visited last.
+  auto it = perroht.Begin();
+  std::advance(it, perroht.Size() - perroht.StashSize());
+  for (; it != perroht.End(); ++it) {
+    ASSERT_TRUE(CoversRange(ranges, &*it, sizeof(*it)));
+  }
+}
+
 TYPED_TEST(PerrohtUniqueTest_KeyValue, Count) {
   TypeParam* perroht = this->perroht_;
   const auto& const_perroht = perroht;
@@ -676,6 +1343,55 @@ TYPED_TEST(PerrohtUniqueTest_KeyValue, EraseUsingIteratorBegin) {
   EXPECT_EQ(perroht->Erase(perroht->CBegin()), perroht->End());
 }
 
+TYPED_TEST(PerrohtUniqueTest_KeyValue, IterateFromFind) {
+  // An iterator returned by Find() visits the entries at and after its
+  // position only; thus, the i-th entry in table order reaches End() in
+  // Size() - i steps.
+  TypeParam* perroht = this->perroht_;
+  for (int i = 0; i < 100; ++i) {
+    perroht->Insert(std::make_pair(i, i));
+  }
+  std::size_t total_steps = 0;
+  for (int i = 0; i < 100; ++i) {
+    for (auto it = perroht->Find(i); it != perroht->End(); ++it) {
+      ++total_steps;
+    }
+  }
+  EXPECT_EQ(total_steps, 100 * 101 / 2);
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, EraseWhileIteratingVisitsOnce) {
+  // Erase(iterator) returns the entry shifted into the erased position or a
+  // later one; it does not wrap around to the entries visited already.
+  TypeParam* perroht = this->perroht_;
+  for (int i = 0; i < 100; ++i) {
+    perroht->Insert(std::make_pair(i, i));
+  }
+  std::size_t visits = 0;
+  for (auto it = perroht->Begin(); it != perroht->End();) {
+    ++visits;
+    if (it->first % 2 == 0) {
+      it = perroht->Erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(visits, 100);
+  EXPECT_EQ(perroht->Size(), 50);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(perroht->Count(i), i % 2);
+  }
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, IteratorConversion) {
+  TypeParam* perroht = this->perroht_;
+  perroht->Insert(std::make_pair(1, 11));
+  typename TypeParam::ConstIterator it;
+  it = perroht->Find(1);
+  EXPECT_EQ(it->second, 11);
+  EXPECT_EQ(it, perroht->CBegin());
+}
+
 TYPED_TEST(PerrohtUniqueTest_KeyValue, LoadFactor) {
   TypeParam* perroht = this->perroht_;
   EXPECT_DOUBLE_EQ(perroht->LoadFactor(), 0.0);
@@ -744,6 +1460,458 @@ TYPED_TEST(PerrohtUniqueTest_KeyValue, Inequality) {
   EXPECT_TRUE(perroht1 == perroht1);
 }
 
+TYPED_TEST(PerrohtUniqueTest_KeyValue, CheckIntegrity) {
+  TypeParam* perroht = this->perroht_;
+  EXPECT_TRUE(perroht->CheckIntegrity());
+
+  for (int i = 0; i < 4096; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_TRUE(perroht->CheckIntegrity(1));
+  EXPECT_TRUE(perroht->CheckIntegrity(4));
+
+  for (int i = 0; i < 4096; i += 3) {
+    perroht->Erase(i);
+  }
+  EXPECT_TRUE(perroht->CheckIntegrity(1));
+  EXPECT_TRUE(perroht->CheckIntegrity(4));
+
+  EXPECT_TRUE(perroht->ShrinkToFit());
+  EXPECT_TRUE(perroht->CheckIntegrity(3));
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, Recover) {
+  TypeParam* perroht = this->perroht_;
+  EXPECT_TRUE(TypeParam::CrashConsistentResize());
+
+  // Nothing to recover
+  EXPECT_TRUE(perroht->Recover());
+
+  for (int i = 0; i < 1024; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_TRUE(perroht->Recover());
+  EXPECT_EQ(perroht->Size(), 1024);
+  for (int i = 0; i < 1024; ++i) {
+    EXPECT_EQ(perroht->Find(i)->second, i * 10);
+  }
+  EXPECT_TRUE(perroht->CheckIntegrity());
+}
+
+TEST(PerrohtNodeTest, ResizeAndCheckIntegrity) {
+  perroht::Perroht<std::string, std::string, std::hash<std::string>,
+                   std::equal_to<std::string>, false>
+      perroht;
+  EXPECT_TRUE(decltype(perroht)::CrashConsistentResize());
+  for (int i = 0; i < 2048; ++i) {
+    perroht.Insert(std::make_pair(std::to_string(i), std::to_string(i * 10)));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(perroht.Recover());
+  for (int i = 0; i < 2048; ++i) {
+    EXPECT_EQ(perroht.Find(std::to_string(i))->second, std::to_string(i * 10));
+  }
+}
+
+// Much larger than the key array entry of its key.
+struct WideValue {
+  std::array<uint64_t, 32> words;
+  bool operator==(const WideValue& other) const {
+    return words == other.words;
+  }
+};
+
+TEST(PerrohtSeparateKeyTest, WideValues) {
+  using map_type =
+      perroht::Perroht<int, WideValue, std::hash<int>, std::equal_to<int>,
+                       true, std::allocator<std::pair<int, WideValue>>,
+                       perroht::SeparateKeyLayout>;
+  const auto make_value = [](const int i) {
+    WideValue value{};
+    value.words.fill(uint64_t(i));
+    return value;
+  };
+  map_type perroht;
+  perroht.MaxLoadFactor(0.95);
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(perroht.Insert(std::make_pair(i, make_value(i))).second);
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 5000; i += 3) {
+    EXPECT_TRUE(perroht.Erase(i));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(perroht.Reserve(perroht.Capacity() * 4));
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(perroht.ShrinkToFit());
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_FALSE(perroht.Contains(i));
+    } else {
+      ASSERT_TRUE(perroht.Find(i)->second == make_value(i));
+    }
+  }
+
+  map_type copy(perroht);
+  EXPECT_TRUE(copy.CheckIntegrity());
+  EXPECT_TRUE(copy == perroht);
+}
+
+TEST(PerrohtSeparateKeyTest, StringKeys) {
+  // Keys that are not bitwise copyable are not copied to the key array.
+  static_assert(!perroht::prhdtls::IsBitwiseCopyableV<std::string>);
+  using map_type =
+      perroht::Perroht<std::string, int, std::hash<std::string>,
+                       std::equal_to<std::string>, true,
+                       std::allocator<std::pair<std::string, int>>,
+                       perroht::SeparateKeyLayout>;
+  map_type perroht;
+  perroht.MaxLoadFactor(0.95);
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_TRUE(perroht.Insert(std::make_pair(std::to_string(i), i)).second);
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10000; i += 3) {
+    EXPECT_TRUE(perroht.Erase(std::to_string(i)));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  EXPECT_TRUE(perroht.Rehash(perroht.Capacity() * 2));
+  EXPECT_TRUE(perroht.CheckIntegrity());
+  for (int i = 0; i < 10000; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_FALSE(perroht.Contains(std::to_string(i)));
+    } else {
+      ASSERT_EQ(perroht.Find(std::to_string(i))->second, i);
+    }
+  }
+
+  map_type copy(perroht);
+  EXPECT_TRUE(copy.CheckIntegrity());
+  EXPECT_TRUE(copy == perroht);
+  map_type moved(std::move(copy));
+  EXPECT_TRUE(moved.CheckIntegrity());
+  EXPECT_EQ(moved.Find("1")->second, 1);
+}
+
+TEST(PerrohtEmbeddedTest, MoveResizeAndRecover) {
+  // Embedded strings are moved between tables, not copied shallowly.
+  perroht::Perroht<std::string, std::string> perroht;
+  EXPECT_FALSE(decltype(perroht)::CrashConsistentResize());
+  for (int i = 0; i < 2048; ++i) {
+    perroht.Insert(std::make_pair(std::to_string(i), std::to_string(i * 10)));
+  }
+  // A completed resize leaves nothing to recover.
+  EXPECT_TRUE(perroht.Recover());
+  EXPECT_TRUE(perroht.Rehash(0));
+  EXPECT_TRUE(perroht.Recover());
+  EXPECT_EQ(perroht.Size(), 2048);
+  for (int i = 0; i < 2048; ++i) {
+    EXPECT_EQ(perroht.Find(std::to_string(i))->second, std::to_string(i * 10));
+  }
+  EXPECT_TRUE(perroht.CheckIntegrity());
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, DirtyPages) {
+  TypeParam* perroht = this->perroht_;
+  for (int i = 0; i < 4096; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_FALSE(perroht->TrackingDirtyPages());
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+  EXPECT_TRUE(perroht->Sync());  // Nothing to sync
+
+  EXPECT_TRUE(perroht->TrackDirtyPages(true));
+  EXPECT_TRUE(perroht->TrackingDirtyPages());
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+
+  perroht->Insert(std::make_pair(4096, 40960));
+  EXPECT_GT(perroht->NumDirtyPages(), 0);
+  EXPECT_TRUE(perroht->Sync());
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+
+  perroht->Erase(1);
+  EXPECT_GT(perroht->NumDirtyPages(), 0);
+  EXPECT_TRUE(perroht->SyncAsync().get());
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+
+  auto it = perroht->Find(2);
+  it->second = 2;
+  perroht->MarkDirty(it);
+  EXPECT_GT(perroht->NumDirtyPages(), 0);
+  EXPECT_TRUE(perroht->Sync());
+
+  // All pages of a new table are dirty
+  const auto capacity = perroht->Capacity();
+  EXPECT_TRUE(perroht->Reserve(capacity * 2));
+  EXPECT_GE(perroht->NumDirtyPages(), 2);
+  EXPECT_TRUE(perroht->Sync());
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+
+  EXPECT_TRUE(perroht->TrackDirtyPages(false));
+  EXPECT_FALSE(perroht->TrackingDirtyPages());
+  perroht->Insert(std::make_pair(4097, 40970));
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+  EXPECT_TRUE(perroht->CheckIntegrity());
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, ApplyBatch) {
+  TypeParam* perroht = this->perroht_;
+  using Op = typename TypeParam::BatchOperation;
+  EXPECT_TRUE(TypeParam::CrashConsistentBatch());
+  perroht->Insert(std::make_pair(1, 10));
+
+  std::vector<Op> ops;
+  ops.push_back(Op::Insert(std::make_pair(1, 11)));  // Already exists
+  ops.push_back(Op::Insert(std::make_pair(2, 20)));
+  ops.push_back(Op::Erase(2));
+  ops.push_back(Op::Insert(std::make_pair(2, 21)));
+  ops.push_back(Op::Insert(std::make_pair(3, 30)));
+  ops.push_back(Op::Erase(1));
+  EXPECT_TRUE(perroht->ApplyBatch(ops));
+  EXPECT_EQ(perroht->NumPendingBatchOperations(), 0);
+  EXPECT_EQ(perroht->Size(), 2);
+  EXPECT_EQ(perroht->Find(2)->second, 21);
+  EXPECT_EQ(perroht->Find(3)->second, 30);
+
+  // Replaying the same batch does not change the result
+  EXPECT_TRUE(perroht->ApplyBatch(ops));
+  EXPECT_EQ(perroht->Size(), 2);
+  EXPECT_EQ(perroht->Find(2)->second, 21);
+  EXPECT_EQ(perroht->Find(3)->second, 30);
+  EXPECT_TRUE(perroht->Recover());
+  EXPECT_TRUE(perroht->CheckIntegrity());
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, Transaction) {
+  TypeParam* perroht = this->perroht_;
+  EXPECT_TRUE(perroht->TrackDirtyPages(true));
+
+  perroht::Transaction<TypeParam> tx(*perroht);
+  for (int i = 0; i < 1024; ++i) {
+    tx.Insert(std::make_pair(i, i * 10));
+  }
+  EXPECT_EQ(tx.NumOperations(), 1024);
+  EXPECT_TRUE(perroht->Empty());
+  EXPECT_TRUE(tx.Commit());
+  EXPECT_EQ(tx.NumOperations(), 0);
+  EXPECT_EQ(perroht->Size(), 1024);
+  EXPECT_EQ(perroht->NumDirtyPages(), 0);
+
+  for (int i = 0; i < 1024; i += 2) {
+    tx.Erase(i);
+  }
+  tx.Abort();
+  EXPECT_TRUE(tx.Commit());
+  EXPECT_EQ(perroht->Size(), 1024);
+
+  tx.Erase(0).Erase(1).Insert(std::make_pair(2000, 1));
+  EXPECT_TRUE(tx.Commit());
+  EXPECT_EQ(perroht->Size(), 1023);
+  EXPECT_FALSE(perroht->Contains(0));
+  EXPECT_TRUE(perroht->Contains(2000));
+  EXPECT_TRUE(perroht->CheckIntegrity());
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, Snapshot) {
+  TypeParam* perroht = this->perroht_;
+  {
+    auto snapshot = perroht->TakeSnapshot();
+    EXPECT_TRUE(snapshot.Valid());
+    EXPECT_EQ(snapshot.Size(), 0);
+    EXPECT_FALSE(snapshot.Contains(0));
+  }
+
+  for (int i = 0; i < 4096; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  auto snapshot = perroht->TakeSnapshot();
+  EXPECT_TRUE(snapshot.Valid());
+  EXPECT_FALSE(perroht->TakeSnapshot().Valid());  // Only one at a time
+  EXPECT_EQ(snapshot.Size(), 4096);
+  EXPECT_EQ(snapshot.NumCopiedPages(), 0);
+
+  for (int i = 0; i < 4096; i += 2) {
+    perroht->Erase(i);
+  }
+  auto it = perroht->Find(1);
+  perroht->MarkDirty(it);
+  it->second = -1;
+  EXPECT_GT(snapshot.NumCopiedPages(), 0);
+
+  for (int i = 0; i < 4096; ++i) {
+    const auto kv = snapshot.Find(i);
+    ASSERT_TRUE(kv.has_value());
+    EXPECT_EQ(kv->second, i * 10);
+  }
+  EXPECT_FALSE(snapshot.Contains(4096));
+
+  // The old table is handed over to the snapshot on resize
+  for (int i = 4096; i < 4096 * 4; ++i) {
+    perroht->Insert(std::make_pair(i, i * 10));
+  }
+  std::size_t count = 0;
+  snapshot.ForEach([&count](const auto& kv) {
+    EXPECT_EQ(kv.second, kv.first * 10);
+    EXPECT_LT(kv.first, 4096);
+    ++count;
+  });
+  EXPECT_EQ(count, 4096);
+
+  snapshot.Release();
+  EXPECT_FALSE(snapshot.Valid());
+  EXPECT_TRUE(perroht->TakeSnapshot().Valid());
+  EXPECT_TRUE(perroht->CheckIntegrity());
+}
+
+TEST(PerrohtSnapshotTest, ConcurrentReader) {
+  using Container = perroht::Perroht<uint64_t, uint64_t>;
+  Container perroht;
+  static constexpr uint64_t kNumInitial = 1 << 14;
+  for (uint64_t i = 0; i < kNumInitial; ++i) {
+    perroht.Insert(std::make_pair(i, i));
+  }
+
+  auto snapshot = perroht.TakeSnapshot();
+  std::thread reader([&snapshot]() {
+    for (int round = 0; round < 4; ++round) {
+      std::size_t count = 0;
+      snapshot.ForEach([&count](const auto& kv) {
+        EXPECT_EQ(kv.first, kv.second);
+        ++count;
+      });
+      EXPECT_EQ(count, kNumInitial);
+      for (uint64_t i = 0; i < kNumInitial; i += 7) {
+        const auto kv = snapshot.Find(i);
+        ASSERT_TRUE(kv.has_value());
+        EXPECT_EQ(kv->second, i);
+      }
+    }
+  });
+
+  for (uint64_t i = 0; i < kNumInitial; i += 3) {
+    perroht.Erase(i);
+  }
+  for (uint64_t i = kNumInitial; i < kNumInitial * 3; ++i) {
+    perroht.Insert(std::make_pair(i, i + 1));
+  }
+  reader.join();
+  EXPECT_TRUE(perroht.CheckIntegrity());
+}
+
+TYPED_TEST(PerrohtUniqueTest_KeyValue, ChangeLog) {
+  TypeParam* perroht = this->perroht_;
+  const std::string log_dir = "./test-perroht-change-log";
+  std::filesystem::remove_all(log_dir);
+
+  uint64_t last_sequence = 0;
+  PerrohtContainer replica;
+  const auto same_as_replica = [&]() {
+    if (replica.Size() != perroht->Size()) return false;
+    for (auto it = perroht->Begin(); it != perroht->End(); ++it) {
+      const auto rit = replica.Find(it->first);
+      if (rit == replica.End() || rit->second != it->second) return false;
+    }
+    return true;
+  };
+  {
+    // Small segments to test rotation
+    typename TypeParam::ChangeLog log(log_dir, 4096, 1024);
+    perroht->AttachChangeLog(&log);
+    for (int i = 0; i < 1024; ++i) {
+      perroht->Insert(std::make_pair(i, i));
+    }
+    for (int i = 0; i < 1024; i += 2) {
+      perroht->Erase(i);
+    }
+    perroht->UpdateValue(perroht->Find(1), 100);
+    EXPECT_TRUE(log.Flush());
+    EXPECT_EQ(log.LastSequence(), 1024 + 512 + 1);
+
+    EXPECT_TRUE(replica.ApplyChanges(log_dir, 0, &last_sequence));
+    EXPECT_EQ(last_sequence, log.LastSequence());
+    EXPECT_TRUE(same_as_replica());
+
+    // Incremental
+    perroht->Clear();
+    perroht->Insert(std::make_pair(5000, 5000));
+    EXPECT_TRUE(log.Flush());
+    EXPECT_TRUE(replica.ApplyChanges(log_dir, last_sequence, &last_sequence));
+    EXPECT_EQ(last_sequence, log.LastSequence());
+    EXPECT_TRUE(same_as_replica());
+    perroht->AttachChangeLog(nullptr);
+  }
+
+  {
+    // Reopen the log; sequence numbers continue.
+    typename TypeParam::ChangeLog log(log_dir, 4096, 2);
+    EXPECT_EQ(log.LastSequence(), last_sequence);
+    perroht->AttachChangeLog(&log);
+    for (int i = 0; i < 1024; ++i) {
+      perroht->Insert(std::make_pair(i, i));
+    }
+    EXPECT_TRUE(log.Flush());
+    perroht->AttachChangeLog(nullptr);
+
+    // The old segments were removed.
+    EXPECT_FALSE(replica.ApplyChanges(log_dir, last_sequence));
+    PerrohtContainer replica2;
+    EXPECT_FALSE(replica2.ApplyChanges(log_dir, 0));
+  }
+  std::filesystem::remove_all(log_dir);
+}
+
+TEST(PerrohtNodeTest, DirtyPages) {
+  perroht::Perroht<std::string, std::string, std::hash<std::string>,
+                   std::equal_to<std::string>, false>
+      perroht;
+  EXPECT_TRUE(perroht.TrackDirtyPages(true));
+  for (int i = 0; i < 2048; ++i) {
+    perroht.Insert(std::make_pair(std::to_string(i), std::to_string(i * 10)));
+  }
+  EXPECT_GT(perroht.NumDirtyPages(), 0);
+  auto future = perroht.SyncAsync();
+  EXPECT_EQ(perroht.NumDirtyPages(), 0);
+  EXPECT_TRUE(future.get());
+
+  // Tracking state moves with the table
+  auto moved(std::move(perroht));
+  EXPECT_TRUE(moved.TrackingDirtyPages());
+  EXPECT_FALSE(perroht.TrackingDirtyPages());
+  moved.Erase("0");
+  EXPECT_GT(moved.NumDirtyPages(), 0);
+  EXPECT_TRUE(moved.Sync());
+
+  // Copies do not inherit it
+  auto copied(moved);
+  EXPECT_FALSE(copied.TrackingDirtyPages());
+  EXPECT_EQ(copied.NumDirtyPages(), 0);
+}
+
+TEST(PerrohtNodeTest, Transaction) {
+  using Container =
+      perroht::Perroht<std::string, std::string, std::hash<std::string>,
+                       std::equal_to<std::string>, false>;
+  EXPECT_FALSE(Container::CrashConsistentBatch());
+  Container perroht;
+  perroht::Transaction<Container> tx(perroht);
+  for (int i = 0; i < 512; ++i) {
+    tx.Insert(std::make_pair(std::to_string(i), std::to_string(i * 10)));
+  }
+  tx.Erase("0");
+  EXPECT_TRUE(tx.Commit());
+  EXPECT_EQ(perroht.Size(), 511);
+  EXPECT_EQ(perroht.Find("511")->second, "5110");
+
+  // The redo log moves with the container
+  Container moved(std::move(perroht));
+  perroht::Transaction<Container> tx2(moved);
+  tx2.Erase("1").Insert(std::make_pair("0", "0"));
+  EXPECT_TRUE(tx2.Commit());
+  EXPECT_EQ(moved.Size(), 511);
+  EXPECT_TRUE(moved.CheckIntegrity());
+}
+
 #ifdef USE_PERSISTENT_ALLOCATOR_TEST
 using metall::container::scoped_allocator_adaptor;
 
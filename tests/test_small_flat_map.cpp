@@ -0,0 +1,183 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <perroht/small_flat_map.hpp>
+
+using small_flat_map = perroht::small_flat_map<int, int, 4>;
+
+// Counts the allocations made through any copy of the allocator.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t* count) : count(count) {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other) : count(other.count) {}
+
+  T* allocate(const std::size_t n) {
+    ++*count;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* const p, const std::size_t n) {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const {
+    return count == other.count;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const {
+    return count != other.count;
+  }
+
+  std::size_t* count;
+};
+
+TEST(SmallFlatMapTest, InsertAndFind) {
+  small_flat_map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert({1, 10}).second);
+  EXPECT_TRUE(map.try_emplace(2, 20).second);
+  EXPECT_TRUE(map.emplace(3, 30).second);
+  map[4] = 40;
+  EXPECT_FALSE(map.insert({1, 11}).second);
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.find(2)->second, 20);
+  EXPECT_EQ(map.count(3), 1);
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_THROW(map.at(5), std::out_of_range);
+
+  // The fifth element moves the elements to a table.
+  map[5] = 50;
+  EXPECT_EQ(map.size(), 5);
+  for (int i = 1; i <= 5; ++i) {
+    ASSERT_EQ(map.at(i), i * 10);
+  }
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 5);
+}
+
+TEST(SmallFlatMapTest, NoAllocationWhileInline) {
+  std::size_t count = 0;
+  using alloc_type = CountingAllocator<std::pair<uint64_t, uint64_t>>;
+  using map_type = perroht::small_flat_map<uint64_t, uint64_t, 8,
+                                           std::hash<uint64_t>,
+                                           std::equal_to<uint64_t>, alloc_type>;
+  map_type map{alloc_type(&count)};
+  for (uint64_t i = 0; i < 8; ++i) {
+    map[i] = i;
+    map.erase(100);
+  }
+  EXPECT_EQ(count, 0);
+  map[8] = 8;
+  EXPECT_GT(count, 0);
+
+  // Clearing the map brings the elements inline again.
+  map.clear();
+  count = 0;
+  map[0] = 0;
+  EXPECT_EQ(count, 0);
+}
+
+TEST(SmallFlatMapTest, RandomOperations) {
+  // Go back and forth across the inline capacity.
+  small_flat_map map;
+  std::unordered_map<int, int> reference;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 100000; ++i) {
+    const int key = rng() % 6;
+    switch (rng() % 4) {
+      case 0:
+        ASSERT_EQ(map.erase(key), reference.erase(key));
+        break;
+      case 1: {
+        const auto it = map.find(key);
+        if (it != map.end()) {
+          map.erase(it);
+          reference.erase(key);
+        }
+        break;
+      }
+      case 2:
+        if (rng() % 64 == 0) {
+          map.clear();
+          reference.clear();
+        }
+        break;
+      default:
+        ASSERT_EQ(map.insert({key, i}).second,
+                  reference.insert({key, i}).second);
+    }
+    ASSERT_EQ(map.size(), reference.size());
+  }
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+}
+
+TEST(SmallFlatMapTest, EraseWhileIterating) {
+  for (const int n : {4, 100}) {
+    small_flat_map map;
+    for (int i = 0; i < n; ++i) {
+      map[i] = i;
+    }
+    for (auto it = map.begin(); it != map.end();) {
+      if (it->second % 2 == 0) {
+        it = map.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    EXPECT_EQ(map.size(), n / 2);
+    for (const auto& [key, value] : map) {
+      EXPECT_EQ(value % 2, 1);
+    }
+  }
+}
+
+TEST(SmallFlatMapTest, CopyMoveAndSwap) {
+  using map_type = perroht::small_flat_map<std::string, std::string, 2>;
+  map_type small;
+  small["a"] = "1";
+  map_type large;
+  for (int i = 0; i < 100; ++i) {
+    large[std::to_string(i)] = std::to_string(i);
+  }
+
+  map_type copy(large);
+  EXPECT_TRUE(copy == large);
+  copy["0"] = "x";
+  EXPECT_TRUE(copy != large);
+  copy = small;
+  EXPECT_TRUE(copy == small);
+
+  map_type moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at("a"), "1");
+
+  swap(moved, large);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(large.size(), 1);
+  EXPECT_EQ(moved.at("99"), "99");
+  EXPECT_EQ(large.at("a"), "1");
+
+  large = std::move(moved);
+  EXPECT_EQ(large.size(), 100);
+  EXPECT_TRUE(moved.empty());
+}
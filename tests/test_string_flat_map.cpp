@@ -0,0 +1,243 @@
+// Copyright 2023 Lawrence Livermore National Security, LLC and other
+// Perroht Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <perroht/mmap_allocator.hpp>
+#include <perroht/string_flat_map.hpp>
+#include <perroht/utilities/hash.hpp>
+
+#include "test_path.hpp"
+
+using string_flat_map = perroht::string_flat_map<int>;
+
+static std::string SegmentPath() {
+  return UniqueTestPath("./test-string-flat-map");
+}
+
+// Counts the allocations made through any copy of the allocator.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t* count) : count(count) {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other) : count(other.count) {}
+
+  T* allocate(const std::size_t n) {
+    ++*count;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* const p, const std::size_t n) {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const {
+    return count == other.count;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const {
+    return count != other.count;
+  }
+
+  std::size_t* count;
+};
+
+// Makes a key of the given length that differs from the other keys of the
+// same length only in the last bytes.
+static std::string MakeKey(const std::size_t length, const int n) {
+  std::string key(length, 'k');
+  const auto suffix = std::to_string(n);
+  key.replace(length - std::min(length, suffix.size()),
+              std::min(length, suffix.size()), suffix);
+  return key;
+}
+
+TEST(StringFlatMapTest, InsertAndFind) {
+  string_flat_map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find("a"), map.end());
+  EXPECT_TRUE(map.insert({"a", 1}).second);
+  EXPECT_TRUE(map.try_emplace("", 0).second);
+  const std::string inline_key(string_flat_map::inline_capacity, 'x');
+  const std::string long_key(string_flat_map::inline_capacity + 1, 'x');
+  map[inline_key] = 2;
+  map[long_key] = 3;
+  EXPECT_FALSE(map.insert({"a", 10}).second);
+  EXPECT_EQ(map.size(), 4);
+
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(map.at(""), 0);
+  EXPECT_EQ(map.at(inline_key), 2);
+  EXPECT_EQ(map.find(long_key)->second, 3);
+  EXPECT_EQ(map.find(long_key)->first, long_key);
+  EXPECT_FALSE(map.contains(long_key + "x"));
+  EXPECT_FALSE(map.contains(long_key.substr(1) + "y"));
+  EXPECT_THROW(map.at("b"), std::out_of_range);
+
+  // Only the long key is stored in the arena.
+  EXPECT_EQ(map.arena_size(), long_key.size());
+}
+
+TEST(StringFlatMapTest, NoAllocationForShortKeys) {
+  std::size_t count = 0;
+  using alloc_type = CountingAllocator<std::pair<std::string, uint64_t>>;
+  using map_type =
+      perroht::string_flat_map<uint64_t, std::hash<std::string_view>,
+                               alloc_type>;
+  map_type map{alloc_type(&count)};
+  map.reserve(1000);
+  EXPECT_EQ(count, 1);
+  for (int i = 0; i < 1000; ++i) {
+    map[MakeKey(1 + i % map_type::inline_capacity, i)] = i;
+  }
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(map.arena_size(), 0);
+
+  // Long keys are appended to the arena, which grows geometrically.
+  for (int i = 0; i < 1000; ++i) {
+    map[MakeKey(100, i)] = i;
+  }
+  EXPECT_EQ(map.arena_size(), 100 * 1000);
+  EXPECT_LT(count, 20);
+}
+
+TEST(StringFlatMapTest, SharedPrefixes) {
+  // Keys that differ after the prefix kept in the table.
+  string_flat_map map;
+  for (const std::size_t length : {1, 12, 23, 24, 35, 200}) {
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_TRUE(map.insert({MakeKey(length, i), i}).second);
+    }
+  }
+  for (const std::size_t length : {1, 12, 23, 24, 35, 200}) {
+    for (int i = 0; i < 100; ++i) {
+      const auto key = MakeKey(length, i);
+      ASSERT_EQ(map.at(key), i);
+      ASSERT_EQ(map.find(key)->first, key);
+    }
+    ASSERT_FALSE(map.contains(MakeKey(length, 100)));
+  }
+}
+
+TEST(StringFlatMapTest, RandomOperations) {
+  string_flat_map map;
+  std::unordered_map<std::string, int> reference;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 100000; ++i) {
+    const auto key = MakeKey(1 + rng() % 48, rng() % 256);
+    switch (rng() % 4) {
+      case 0:
+        ASSERT_EQ(map.erase(key), reference.erase(key));
+        break;
+      case 1:
+        if (rng() % 1024 == 0) {
+          map.rehash(0);
+        }
+        break;
+      default:
+        ASSERT_EQ(map.insert({key, i}).second,
+                  reference.insert({key, i}).second);
+    }
+    ASSERT_EQ(map.size(), reference.size());
+  }
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+  for (const auto& [key, value] : map) {
+    ASSERT_EQ(reference.at(std::string(key)), value);
+  }
+
+  // Rehashing reclaims the space of erased long keys.
+  map.rehash(0);
+  std::size_t live = 0;
+  for (const auto& [key, value] : map) {
+    if (key.size() > string_flat_map::inline_capacity) {
+      live += key.size();
+    }
+  }
+  EXPECT_EQ(map.arena_size(), live);
+  for (const auto& [key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+}
+
+TEST(StringFlatMapTest, CopyMoveAndSwap) {
+  using map_type = perroht::string_flat_map<std::string>;
+  map_type map;
+  for (int i = 0; i < 100; ++i) {
+    map[MakeKey(5 + i, i)] = std::to_string(i);
+  }
+  map_type copy(map);
+  EXPECT_TRUE(copy == map);
+  copy[MakeKey(50, 45)] = "x";
+  EXPECT_TRUE(copy != map);
+
+  map_type moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at(MakeKey(50, 45)), "x");
+
+  swap(moved, map);
+  EXPECT_EQ(map.at(MakeKey(50, 45)), "x");
+  EXPECT_EQ(moved.at(MakeKey(50, 45)), "45");
+
+  map = moved;
+  EXPECT_TRUE(map == moved);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.arena_size(), 0);
+  EXPECT_FALSE(map.contains(MakeKey(50, 45)));
+}
+
+TEST(StringFlatMapTest, StringHash) {
+  perroht::string_flat_map<int, perroht::StringHash<std::string_view>> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[MakeKey(8 + i % 40, i)] = i;
+  }
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map.at(MakeKey(8 + i % 40, i)), i);
+  }
+  EXPECT_EQ(perroht::StringHash<std::string_view>()("abc"),
+            perroht::StringHash<std::string>()("abc"));
+}
+
+TEST(StringFlatMapTest, Persist) {
+  using alloc_type = perroht::mmap_allocator<std::pair<std::string, int>>;
+  using map_type =
+      perroht::string_flat_map<int, std::hash<std::string_view>, alloc_type>;
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::create_only);
+    auto* map = segment.construct<map_type>("map", alloc_type(segment));
+    ASSERT_NE(map, nullptr);
+    for (int i = 0; i < 10000; ++i) {
+      (*map)[MakeKey(1 + i % 64, i)] = i;
+    }
+  }
+  {
+    perroht::mmap_segment segment(SegmentPath(), perroht::open_only);
+    auto* map = segment.find<map_type>("map");
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map->size(), 10000);
+    for (int i = 0; i < 10000; ++i) {
+      ASSERT_EQ(map->at(MakeKey(1 + i % 64, i)), i);
+    }
+    EXPECT_TRUE(segment.destroy<map_type>("map"));
+  }
+  std::remove(SegmentPath().c_str());
+}